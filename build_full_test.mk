@@ -14,7 +14,8 @@
 # along with this program.  If not, see <http://www.gnu.org/licenses/>.
 
 $(TEST)_INC := \
-	tests\test_common\common_config.h
+	tests\test_common\common_config.h \
+	$(TEST_PATH)
 
 $(TEST)_SRC := \
 	$(TMK_COMMON_SRC) \
@@ -29,6 +30,16 @@ $(TEST)_SRC := \
 	tests/test_common/test_logger.cpp \
 	$(patsubst $(ROOTDIR)/%,%,$(wildcard $(TEST_PATH)/*.cpp))
 
+ifeq ($(strip $(RGB_MATRIX_ENABLE)), yes)
+    ifeq ($(strip $(RGB_MATRIX_DRIVER)), custom)
+        $(TEST)_SRC += tests/test_common/test_rgb_matrix.cpp
+    endif
+endif
+
+ifeq ($(strip $(POINTING_DEVICE_ENABLE)), yes)
+    $(TEST)_SRC += tests/test_common/test_pointing_device.cpp
+endif
+
 $(TEST)_DEFS := $(TMK_COMMON_DEFS) $(OPT_DEFS)
 
 $(TEST)_CONFIG := $(TEST_PATH)/config.h
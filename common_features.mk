@@ -119,6 +119,17 @@ ifeq ($(strip $(POINTING_DEVICE_ENABLE)), yes)
         MOUSE_ENABLE := yes
         SRC += $(QUANTUM_DIR)/pointing_device.c
         SRC += $(QUANTUM_DIR)/pointing_device_drivers.c
+        ifeq ($(strip $(POINTING_DEVICE_MOTION_IRQ_ENABLE)), yes)
+            ifneq ($(PLATFORM),CHIBIOS)
+                $(error POINTING_DEVICE_MOTION_IRQ_ENABLE is only supported on ChibiOS)
+            endif
+            SRC += $(PLATFORM_COMMON_DIR)/pointing_device_motion.c
+            OPT_DEFS += -DPOINTING_DEVICE_MOTION_IRQ_ENABLE
+        endif
+        ifeq ($(strip $(POINTING_DEVICE_ACCEL_ENABLE)), yes)
+            SRC += $(QUANTUM_DIR)/pointing_device_accel.c
+            OPT_DEFS += -DPOINTING_DEVICE_ACCEL_ENABLE
+        endif
         ifneq ($(strip $(POINTING_DEVICE_DRIVER)), custom)
             SRC += drivers/sensors/$(strip $(POINTING_DEVICE_DRIVER)).c
             OPT_DEFS += -DPOINTING_DEVICE_DRIVER_$(strip $(shell echo $(POINTING_DEVICE_DRIVER) | tr '[:lower:]' '[:upper:]'))
@@ -148,7 +159,7 @@ ifeq ($(strip $(POINTING_DEVICE_ENABLE)), yes)
     endif
 endif
 
-VALID_EEPROM_DRIVER_TYPES := vendor custom transient i2c spi
+VALID_EEPROM_DRIVER_TYPES := vendor custom transient i2c spi journal
 EEPROM_DRIVER ?= vendor
 ifeq ($(filter $(EEPROM_DRIVER),$(VALID_EEPROM_DRIVER_TYPES)),)
   $(error EEPROM_DRIVER="$(EEPROM_DRIVER)" is not a valid EEPROM driver)
@@ -172,6 +183,16 @@ else
     OPT_DEFS += -DEEPROM_DRIVER -DEEPROM_TRANSIENT
     COMMON_VPATH += $(DRIVER_PATH)/eeprom
     SRC += eeprom_driver.c eeprom_transient.c
+  else ifeq ($(strip $(EEPROM_DRIVER)), journal)
+    ifneq ($(filter STM32F3xx_% STM32F1xx_% %_STM32F072xB %_STM32F042x6 %_GD32VF103xB %_GD32VF103x8, $(MCU_SERIES)_$(MCU_LDSCRIPT)),)
+      OPT_DEFS += -DEEPROM_DRIVER -DEEPROM_JOURNAL
+      COMMON_VPATH += $(DRIVER_PATH)/eeprom
+      SRC += eeprom_driver.c
+      SRC += $(PLATFORM_COMMON_DIR)/eeprom_stm32_journal.c
+      SRC += $(PLATFORM_COMMON_DIR)/flash_stm32.c
+    else
+      $(error EEPROM_DRIVER=journal is not supported on MCU_SERIES="$(MCU_SERIES)", it needs flash with small uniform pages)
+    endif
   else ifeq ($(strip $(EEPROM_DRIVER)), vendor)
     OPT_DEFS += -DEEPROM_VENDOR
     ifeq ($(PLATFORM),AVR)
@@ -201,6 +222,16 @@ else
   endif
 endif
 
+ifeq ($(strip $(EEPROM_WRITE_BEHIND_ENABLE)), yes)
+    ifeq ($(filter -DEEPROM_DRIVER,$(OPT_DEFS)),)
+        $(error EEPROM_WRITE_BEHIND_ENABLE requires an EEPROM driver built on eeprom_driver.c, which EEPROM_DRIVER="$(EEPROM_DRIVER)" does not use on this MCU)
+    endif
+    ifeq ($(strip $(EEPROM_DRIVER)), journal)
+        $(error EEPROM_WRITE_BEHIND_ENABLE cannot be used with EEPROM_DRIVER=journal, which already caches in RAM)
+    endif
+    OPT_DEFS += -DEEPROM_WRITE_BEHIND_ENABLE
+endif
+
 RGBLIGHT_ENABLE ?= no
 VALID_RGBLIGHT_TYPES := WS2812 APA102 custom
 
@@ -375,6 +406,17 @@ ifeq ($(strip $(SLEEP_LED_ENABLE)), yes)
     NO_SUSPEND_POWER_DOWN := yes
 endif
 
+ifeq ($(strip $(MATRIX_WAKE_ENABLE)), yes)
+    ifneq ($(PLATFORM),CHIBIOS)
+        $(error MATRIX_WAKE_ENABLE is only supported on ChibiOS)
+    endif
+    ifneq ($(filter yes lite,$(strip $(CUSTOM_MATRIX))),)
+        $(error MATRIX_WAKE_ENABLE requires the default matrix implementation)
+    endif
+    SRC += $(PLATFORM_COMMON_DIR)/matrix_wake.c
+    OPT_DEFS += -DMATRIX_WAKE_ENABLE
+endif
+
 VALID_BACKLIGHT_TYPES := pwm timer software custom
 
 BACKLIGHT_ENABLE ?= no
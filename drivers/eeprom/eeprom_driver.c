@@ -15,10 +15,161 @@
  */
 
 #include <stdint.h>
+#include <stdbool.h>
 #include <string.h>
 
 #include "eeprom_driver.h"
 
+#ifdef EEPROM_WRITE_BEHIND_ENABLE
+#    include "timer.h"
+
+#    ifndef EEPROM_WRITE_BEHIND_PAGE_SIZE
+#        define EEPROM_WRITE_BEHIND_PAGE_SIZE 32
+#    endif
+#    ifndef EEPROM_WRITE_BEHIND_PAGES
+#        define EEPROM_WRITE_BEHIND_PAGES 4
+#    endif
+#    ifndef EEPROM_WRITE_BEHIND_DELAY
+#        define EEPROM_WRITE_BEHIND_DELAY 100
+#    endif
+#    if EEPROM_WRITE_BEHIND_PAGE_SIZE > 256
+#        error "EEPROM_WRITE_BEHIND_PAGE_SIZE must be 256 or less"
+#    endif
+
+/* Pages with pending writes. Each holds a full copy of one page of the EEPROM, with the
+ * range [dirty_start, dirty_end) still to be written back to the driver.
+ */
+typedef struct {
+    uintptr_t base;
+    uint16_t  dirty_start;
+    uint16_t  dirty_end;
+    bool      used;
+    uint8_t   data[EEPROM_WRITE_BEHIND_PAGE_SIZE];
+} eeprom_page_t;
+
+static eeprom_page_t eeprom_pages[EEPROM_WRITE_BEHIND_PAGES];
+static uint8_t       eeprom_next_victim = 0;
+static uint32_t      eeprom_last_write  = 0;
+
+static eeprom_page_t *eeprom_find_page(uintptr_t base) {
+    for (uint8_t i = 0; i < EEPROM_WRITE_BEHIND_PAGES; i++) {
+        if (eeprom_pages[i].used && eeprom_pages[i].base == base) {
+            return &eeprom_pages[i];
+        }
+    }
+    return NULL;
+}
+
+static void eeprom_page_flush(eeprom_page_t *page) {
+    eeprom_driver_write_block(&page->data[page->dirty_start], (void *)(page->base + page->dirty_start), page->dirty_end - page->dirty_start);
+    page->used = false;
+}
+
+/* Claims a page for `base`, writing one out first (round robin) if all of them hold pending writes */
+static eeprom_page_t *eeprom_claim_page(uintptr_t base) {
+    eeprom_page_t *page = NULL;
+    for (uint8_t i = 0; i < EEPROM_WRITE_BEHIND_PAGES && !page; i++) {
+        if (!eeprom_pages[i].used) {
+            page = &eeprom_pages[i];
+        }
+    }
+    if (!page) {
+        page               = &eeprom_pages[eeprom_next_victim];
+        eeprom_next_victim = (eeprom_next_victim + 1) % EEPROM_WRITE_BEHIND_PAGES;
+        eeprom_page_flush(page);
+    }
+
+    eeprom_driver_read_block(page->data, (const void *)base, EEPROM_WRITE_BEHIND_PAGE_SIZE);
+    page->base        = base;
+    page->dirty_start = EEPROM_WRITE_BEHIND_PAGE_SIZE;
+    page->dirty_end   = 0;
+    page->used        = true;
+    return page;
+}
+
+void eeprom_read_block(void *buf, const void *addr, size_t len) {
+    uintptr_t target = (uintptr_t)addr;
+    uint8_t * dest   = (uint8_t *)buf;
+
+    while (len > 0) {
+        uintptr_t offset = target % EEPROM_WRITE_BEHIND_PAGE_SIZE;
+        size_t    chunk  = EEPROM_WRITE_BEHIND_PAGE_SIZE - offset;
+        if (chunk > len) chunk = len;
+
+        eeprom_page_t *page = eeprom_find_page(target - offset);
+        if (page) {
+            memcpy(dest, &page->data[offset], chunk);
+        } else {
+            eeprom_driver_read_block(dest, (const void *)target, chunk);
+        }
+        target += chunk;
+        dest += chunk;
+        len -= chunk;
+    }
+}
+
+void eeprom_write_block(const void *buf, void *addr, size_t len) {
+    uintptr_t      target = (uintptr_t)addr;
+    const uint8_t *src    = (const uint8_t *)buf;
+
+    while (len > 0) {
+        uintptr_t offset = target % EEPROM_WRITE_BEHIND_PAGE_SIZE;
+        size_t    chunk  = EEPROM_WRITE_BEHIND_PAGE_SIZE - offset;
+        if (chunk > len) chunk = len;
+
+        eeprom_page_t *page = eeprom_find_page(target - offset);
+        if (!page) {
+            page = eeprom_claim_page(target - offset);
+        }
+        memcpy(&page->data[offset], src, chunk);
+        if (offset < page->dirty_start) page->dirty_start = offset;
+        if (offset + chunk > page->dirty_end) page->dirty_end = offset + chunk;
+
+        target += chunk;
+        src += chunk;
+        len -= chunk;
+    }
+    eeprom_last_write = timer_read32();
+}
+
+/** \brief Writes back at most one page of pending writes.
+ *
+ * Called from the main loop. Nothing is written until no writes have come in for
+ * EEPROM_WRITE_BEHIND_DELAY milliseconds, so repeated writes to the same bytes reach the driver once.
+ */
+void eeprom_write_behind_task(void) {
+    if (timer_elapsed32(eeprom_last_write) < EEPROM_WRITE_BEHIND_DELAY) {
+        return;
+    }
+    for (uint8_t i = 0; i < EEPROM_WRITE_BEHIND_PAGES; i++) {
+        if (eeprom_pages[i].used) {
+            eeprom_page_flush(&eeprom_pages[i]);
+            return;
+        }
+    }
+}
+
+/* Writes back everything that is pending, e.g. before suspend or jumping to the bootloader */
+void eeprom_write_behind_flush(void) {
+    for (uint8_t i = 0; i < EEPROM_WRITE_BEHIND_PAGES; i++) {
+        if (eeprom_pages[i].used) {
+            eeprom_page_flush(&eeprom_pages[i]);
+        }
+    }
+}
+
+/* Drops pending writes, for when the whole EEPROM is about to be erased */
+void eeprom_write_behind_discard(void) {
+    for (uint8_t i = 0; i < EEPROM_WRITE_BEHIND_PAGES; i++) {
+        eeprom_pages[i].used = false;
+    }
+}
+#else
+void eeprom_read_block(void *buf, const void *addr, size_t len) { eeprom_driver_read_block(buf, addr, len); }
+
+void eeprom_write_block(const void *buf, void *addr, size_t len) { eeprom_driver_write_block(buf, addr, len); }
+#endif
+
 uint8_t eeprom_read_byte(const uint8_t *addr) {
     uint8_t ret = 0;
     eeprom_read_block(&ret, addr, 1);
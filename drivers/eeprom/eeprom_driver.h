@@ -20,3 +20,11 @@
 
 void eeprom_driver_init(void);
 void eeprom_driver_erase(void);
+void eeprom_driver_read_block(void *buf, const void *addr, size_t len);
+void eeprom_driver_write_block(const void *buf, void *addr, size_t len);
+
+#ifdef EEPROM_WRITE_BEHIND_ENABLE
+void eeprom_write_behind_task(void);
+void eeprom_write_behind_flush(void);
+void eeprom_write_behind_discard(void);
+#endif
@@ -34,7 +34,7 @@
 #include "debug.h"
 #include "timer.h"
 #include "spi_master.h"
-#include "eeprom.h"
+#include "eeprom_driver.h"
 #include "eeprom_spi.h"
 
 #define CMD_WREN 6
@@ -90,7 +90,7 @@ void eeprom_driver_erase(void) {
     uint8_t buf[EXTERNAL_EEPROM_PAGE_SIZE];
     memset(buf, 0x00, EXTERNAL_EEPROM_PAGE_SIZE);
     for (uint32_t addr = 0; addr < EXTERNAL_EEPROM_BYTE_COUNT; addr += EXTERNAL_EEPROM_PAGE_SIZE) {
-        eeprom_write_block(buf, (void *)(uintptr_t)addr, EXTERNAL_EEPROM_PAGE_SIZE);
+        eeprom_driver_write_block(buf, (void *)(uintptr_t)addr, EXTERNAL_EEPROM_PAGE_SIZE);
     }
 
 #if defined(CONSOLE_ENABLE) && defined(DEBUG_EEPROM_OUTPUT)
@@ -98,7 +98,7 @@ void eeprom_driver_erase(void) {
 #endif
 }
 
-void eeprom_read_block(void *buf, const void *addr, size_t len) {
+void eeprom_driver_read_block(void *buf, const void *addr, size_t len) {
     //-------------------------------------------------
     // Wait for the write-in-progress bit to be cleared
     bool res = spi_eeprom_start();
@@ -140,7 +140,7 @@ void eeprom_read_block(void *buf, const void *addr, size_t len) {
     spi_stop();
 }
 
-void eeprom_write_block(const void *buf, void *addr, size_t len) {
+void eeprom_driver_write_block(const void *buf, void *addr, size_t len) {
     bool      res;
     uint8_t * read_buf    = (uint8_t *)buf;
     uintptr_t target_addr = (uintptr_t)addr;
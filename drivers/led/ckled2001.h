@@ -41,7 +41,7 @@ void CKLED2001_set_led_control_register(uint8_t index, bool red, bool green, boo
 // This should not be called from an interrupt
 // (eg. from a timer interrupt).
 // Call this while idle (in between matrix scans).
-// If the buffer is dirty, it will update the driver with the buffer.
+// Only the 16 byte blocks of the buffer that changed since the last update are sent.
 void CKLED2001_update_pwm_buffers(uint8_t addr, uint8_t index);
 void CKLED2001_update_led_control_registers(uint8_t addr, uint8_t index);
 
@@ -65,8 +65,9 @@ uint8_t g_twi_transfer_buffer[20];
 // We could optimize this and take out the unused registers from these
 // buffers and the transfers in IS31FL3731_write_pwm_buffer() but it's
 // probably not worth the extra complexity.
-uint8_t g_pwm_buffer[DRIVER_COUNT][144];
-bool    g_pwm_buffer_update_required[DRIVER_COUNT] = {false};
+uint8_t  g_pwm_buffer[DRIVER_COUNT][144];
+// One bit per 16 byte block of g_pwm_buffer, set when the block has changed since it was sent
+uint16_t g_pwm_buffer_dirty[DRIVER_COUNT] = {0};
 
 uint8_t g_led_control_registers[DRIVER_COUNT][18]             = {{0}};
 bool    g_led_control_registers_update_required[DRIVER_COUNT] = {false};
@@ -98,14 +99,15 @@ void IS31FL3731_write_register(uint8_t addr, uint8_t reg, uint8_t data) {
 #endif
 }
 
-void IS31FL3731_write_pwm_buffer(uint8_t addr, uint8_t *pwm_buffer) {
+static void IS31FL3731_write_pwm_blocks(uint8_t addr, uint8_t *pwm_buffer, uint16_t blocks) {
     // assumes bank is already selected
 
-    // transmit PWM registers in 9 transfers of 16 bytes
+    // transmit PWM registers in up to 9 transfers of 16 bytes, one for each block set in blocks
     // g_twi_transfer_buffer[] is 20 bytes
 
     // iterate over the pwm_buffer contents at 16 byte intervals
     for (int i = 0; i < 144; i += 16) {
+        if (!(blocks & (1 << (i / 16)))) continue;
         // set the first register, e.g. 0x24, 0x34, 0x44, etc.
         g_twi_transfer_buffer[0] = 0x24 + i;
         // copy the data from i to i+15
@@ -125,6 +127,8 @@ void IS31FL3731_write_pwm_buffer(uint8_t addr, uint8_t *pwm_buffer) {
     }
 }
 
+void IS31FL3731_write_pwm_buffer(uint8_t addr, uint8_t *pwm_buffer) { IS31FL3731_write_pwm_blocks(addr, pwm_buffer, UINT16_MAX); }
+
 void IS31FL3731_init(uint8_t addr) {
     // In order to avoid the LEDs being driven with garbage data
     // in the LED driver's PWM registers, first enable software shutdown,
@@ -180,16 +184,24 @@ void IS31FL3731_init(uint8_t addr) {
     IS31FL3731_write_register(addr, ISSI_COMMANDREGISTER, 0);
 }
 
+static void IS31FL3731_set_pwm(uint8_t driver, uint8_t reg, uint8_t value) {
+    // Subtract 0x24 to get the second index of g_pwm_buffer
+    reg -= 0x24;
+    // Only changes need to be sent
+    if (g_pwm_buffer[driver][reg] != value) {
+        g_pwm_buffer[driver][reg] = value;
+        g_pwm_buffer_dirty[driver] |= 1 << (reg / 16);
+    }
+}
+
 void IS31FL3731_set_color(int index, uint8_t red, uint8_t green, uint8_t blue) {
     is31_led led;
     if (index >= 0 && index < DRIVER_LED_TOTAL) {
         memcpy_P(&led, (&g_is31_leds[index]), sizeof(led));
 
-        // Subtract 0x24 to get the second index of g_pwm_buffer
-        g_pwm_buffer[led.driver][led.r - 0x24]   = red;
-        g_pwm_buffer[led.driver][led.g - 0x24]   = green;
-        g_pwm_buffer[led.driver][led.b - 0x24]   = blue;
-        g_pwm_buffer_update_required[led.driver] = true;
+        IS31FL3731_set_pwm(led.driver, led.r, red);
+        IS31FL3731_set_pwm(led.driver, led.g, green);
+        IS31FL3731_set_pwm(led.driver, led.b, blue);
     }
 }
 
@@ -230,10 +242,10 @@ void IS31FL3731_set_led_control_register(uint8_t index, bool red, bool green, bo
 }
 
 void IS31FL3731_update_pwm_buffers(uint8_t addr, uint8_t index) {
-    if (g_pwm_buffer_update_required[index]) {
-        IS31FL3731_write_pwm_buffer(addr, g_pwm_buffer[index]);
+    if (g_pwm_buffer_dirty[index]) {
+        IS31FL3731_write_pwm_blocks(addr, g_pwm_buffer[index], g_pwm_buffer_dirty[index]);
     }
-    g_pwm_buffer_update_required[index] = false;
+    g_pwm_buffer_dirty[index] = 0;
 }
 
 void IS31FL3731_update_led_control_registers(uint8_t addr, uint8_t index) {
@@ -42,7 +42,7 @@ void IS31FL3731_set_led_control_register(uint8_t index, bool red, bool green, bo
 // This should not be called from an interrupt
 // (eg. from a timer interrupt).
 // Call this while idle (in between matrix scans).
-// If the buffer is dirty, it will update the driver with the buffer.
+// Only the 16 byte blocks of the buffer that changed since the last update are sent.
 void IS31FL3731_update_pwm_buffers(uint8_t addr, uint8_t index);
 void IS31FL3731_update_led_control_registers(uint8_t addr, uint8_t index);
 
@@ -78,8 +78,9 @@ uint8_t g_twi_transfer_buffer[20];
 // We could optimize this and take out the unused registers from these
 // buffers and the transfers in IS31FL3733_write_pwm_buffer() but it's
 // probably not worth the extra complexity.
-uint8_t g_pwm_buffer[DRIVER_COUNT][192];
-bool    g_pwm_buffer_update_required[DRIVER_COUNT] = {false};
+uint8_t  g_pwm_buffer[DRIVER_COUNT][192];
+// One bit per 16 byte block of g_pwm_buffer, set when the block has changed since it was sent
+uint16_t g_pwm_buffer_dirty[DRIVER_COUNT] = {0};
 
 uint8_t g_led_control_registers[DRIVER_COUNT][24]             = {0};
 bool    g_led_control_registers_update_required[DRIVER_COUNT] = {false};
@@ -103,14 +104,15 @@ bool IS31FL3733_write_register(uint8_t addr, uint8_t reg, uint8_t data) {
     return true;
 }
 
-bool IS31FL3733_write_pwm_buffer(uint8_t addr, uint8_t *pwm_buffer) {
+static bool IS31FL3733_write_pwm_blocks(uint8_t addr, uint8_t *pwm_buffer, uint16_t blocks) {
     // Assumes PG1 is already selected.
     // If any of the transactions fails function returns false.
-    // Transmit PWM registers in 12 transfers of 16 bytes.
+    // Transmit PWM registers in up to 12 transfers of 16 bytes, one for each block set in blocks.
     // g_twi_transfer_buffer[] is 20 bytes
 
     // Iterate over the pwm_buffer contents at 16 byte intervals.
     for (int i = 0; i < 192; i += 16) {
+        if (!(blocks & (1 << (i / 16)))) continue;
         g_twi_transfer_buffer[0] = i;
         // Copy the data from i to i+15.
         // Device will auto-increment register for data after the first byte
@@ -134,6 +136,8 @@ bool IS31FL3733_write_pwm_buffer(uint8_t addr, uint8_t *pwm_buffer) {
     return true;
 }
 
+bool IS31FL3733_write_pwm_buffer(uint8_t addr, uint8_t *pwm_buffer) { return IS31FL3733_write_pwm_blocks(addr, pwm_buffer, UINT16_MAX); }
+
 void IS31FL3733_init(uint8_t addr, uint8_t sync) {
     // In order to avoid the LEDs being driven with garbage data
     // in the LED driver's PWM registers, shutdown is enabled last.
@@ -180,15 +184,22 @@ void IS31FL3733_init(uint8_t addr, uint8_t sync) {
     wait_ms(10);
 }
 
+static void IS31FL3733_set_pwm(uint8_t driver, uint8_t reg, uint8_t value) {
+    // Only changes need to be sent
+    if (g_pwm_buffer[driver][reg] != value) {
+        g_pwm_buffer[driver][reg] = value;
+        g_pwm_buffer_dirty[driver] |= 1 << (reg / 16);
+    }
+}
+
 void IS31FL3733_set_color(int index, uint8_t red, uint8_t green, uint8_t blue) {
     is31_led led;
     if (index >= 0 && index < DRIVER_LED_TOTAL) {
         memcpy_P(&led, (&g_is31_leds[index]), sizeof(led));
 
-        g_pwm_buffer[led.driver][led.r]          = red;
-        g_pwm_buffer[led.driver][led.g]          = green;
-        g_pwm_buffer[led.driver][led.b]          = blue;
-        g_pwm_buffer_update_required[led.driver] = true;
+        IS31FL3733_set_pwm(led.driver, led.r, red);
+        IS31FL3733_set_pwm(led.driver, led.g, green);
+        IS31FL3733_set_pwm(led.driver, led.b, blue);
     }
 }
 
@@ -229,18 +240,20 @@ void IS31FL3733_set_led_control_register(uint8_t index, bool red, bool green, bo
 }
 
 void IS31FL3733_update_pwm_buffers(uint8_t addr, uint8_t index) {
-    if (g_pwm_buffer_update_required[index]) {
+    if (g_pwm_buffer_dirty[index]) {
         // Firstly we need to unlock the command register and select PG1.
         IS31FL3733_write_register(addr, ISSI_COMMANDREGISTER_WRITELOCK, 0xC5);
         IS31FL3733_write_register(addr, ISSI_COMMANDREGISTER, ISSI_PAGE_PWM);
 
         // If any of the transactions fail we risk writing dirty PG0,
         // refresh page 0 just in case.
-        if (!IS31FL3733_write_pwm_buffer(addr, g_pwm_buffer[index])) {
+        // The blocks stay dirty so they are sent again with the next update.
+        if (!IS31FL3733_write_pwm_blocks(addr, g_pwm_buffer[index], g_pwm_buffer_dirty[index])) {
             g_led_control_registers_update_required[index] = true;
+            return;
         }
     }
-    g_pwm_buffer_update_required[index] = false;
+    g_pwm_buffer_dirty[index] = 0;
 }
 
 void IS31FL3733_update_led_control_registers(uint8_t addr, uint8_t index) {
@@ -80,9 +80,10 @@ uint8_t g_twi_transfer_buffer[20] = {0xFF};
 // We could optimize this and take out the unused registers from these
 // buffers and the transfers in IS31FL3741_write_pwm_buffer() but it's
 // probably not worth the extra complexity.
-uint8_t g_pwm_buffer[DRIVER_COUNT][ISSI_MAX_LEDS];
-bool    g_pwm_buffer_update_required[DRIVER_COUNT]        = {false};
-bool    g_scaling_registers_update_required[DRIVER_COUNT] = {false};
+uint8_t  g_pwm_buffer[DRIVER_COUNT][ISSI_MAX_LEDS];
+// One bit per 18 byte block of g_pwm_buffer, set when the block has changed since it was sent
+uint32_t g_pwm_buffer_dirty[DRIVER_COUNT]                  = {0};
+bool     g_scaling_registers_update_required[DRIVER_COUNT] = {false};
 
 uint8_t g_scaling_registers[DRIVER_COUNT][ISSI_MAX_LEDS];
 
@@ -99,53 +100,46 @@ void IS31FL3741_write_register(uint8_t addr, uint8_t reg, uint8_t data) {
 #endif
 }
 
-bool IS31FL3741_write_pwm_buffer(uint8_t addr, uint8_t *pwm_buffer) {
-    // unlock the command register and select PG2
-    IS31FL3741_write_register(addr, ISSI_COMMANDREGISTER_WRITELOCK, 0xC5);
-    IS31FL3741_write_register(addr, ISSI_COMMANDREGISTER, ISSI_PAGE_PWM0);
+static bool IS31FL3741_write_pwm_blocks(uint8_t addr, uint8_t *pwm_buffer, uint32_t blocks) {
+    // no page selected yet
+    uint8_t page = UINT8_MAX;
+
+    // transmit PWM registers in up to 20 transfers of 18 bytes, one for each block set in blocks,
+    // the last one only 9 bytes long as the total number is 351
+    for (int i = 0; i < ISSI_MAX_LEDS; i += 18) {
+        if (!(blocks & (1UL << (i / 18)))) continue;
 
-    for (int i = 0; i < 342; i += 18) {
-        if (i == 180) {
-            // unlock the command register and select PG2
+        // PG0 holds the first 180 registers and PG1 the rest
+        uint8_t block_page = i < 180 ? ISSI_PAGE_PWM0 : ISSI_PAGE_PWM1;
+        if (page != block_page) {
+            // unlock the command register and select the page
             IS31FL3741_write_register(addr, ISSI_COMMANDREGISTER_WRITELOCK, 0xC5);
-            IS31FL3741_write_register(addr, ISSI_COMMANDREGISTER, ISSI_PAGE_PWM1);
+            IS31FL3741_write_register(addr, ISSI_COMMANDREGISTER, block_page);
+            page = block_page;
         }
 
+        uint8_t length           = ISSI_MAX_LEDS - i < 18 ? ISSI_MAX_LEDS - i : 18;
         g_twi_transfer_buffer[0] = i % 180;
-        memcpy(g_twi_transfer_buffer + 1, pwm_buffer + i, 18);
+        memcpy(g_twi_transfer_buffer + 1, pwm_buffer + i, length);
 
 #if ISSI_PERSISTENCE > 0
         for (uint8_t i = 0; i < ISSI_PERSISTENCE; i++) {
-            if (i2c_transmit(addr << 1, g_twi_transfer_buffer, 19, ISSI_TIMEOUT) != 0) {
+            if (i2c_transmit(addr << 1, g_twi_transfer_buffer, length + 1, ISSI_TIMEOUT) != 0) {
                 return false;
             }
         }
 #else
-        if (i2c_transmit(addr << 1, g_twi_transfer_buffer, 19, ISSI_TIMEOUT) != 0) {
+        if (i2c_transmit(addr << 1, g_twi_transfer_buffer, length + 1, ISSI_TIMEOUT) != 0) {
             return false;
         }
 #endif
     }
 
-    // transfer the left cause the total number is 351
-    g_twi_transfer_buffer[0] = 162;
-    memcpy(g_twi_transfer_buffer + 1, pwm_buffer + 342, 9);
-
-#if ISSI_PERSISTENCE > 0
-    for (uint8_t i = 0; i < ISSI_PERSISTENCE; i++) {
-        if (i2c_transmit(addr << 1, g_twi_transfer_buffer, 10, ISSI_TIMEOUT) != 0) {
-            return false;
-        }
-    }
-#else
-    if (i2c_transmit(addr << 1, g_twi_transfer_buffer, 10, ISSI_TIMEOUT) != 0) {
-        return false;
-    }
-#endif
-
     return true;
 }
 
+bool IS31FL3741_write_pwm_buffer(uint8_t addr, uint8_t *pwm_buffer) { return IS31FL3741_write_pwm_blocks(addr, pwm_buffer, UINT32_MAX); }
+
 void IS31FL3741_init(uint8_t addr) {
     // In order to avoid the LEDs being driven with garbage data
     // in the LED driver's PWM registers, shutdown is enabled last.
@@ -173,15 +167,22 @@ void IS31FL3741_init(uint8_t addr) {
     wait_ms(10);
 }
 
+static void IS31FL3741_set_pwm(uint8_t driver, uint16_t reg, uint8_t value) {
+    // Only changes need to be sent
+    if (g_pwm_buffer[driver][reg] != value) {
+        g_pwm_buffer[driver][reg] = value;
+        g_pwm_buffer_dirty[driver] |= 1UL << (reg / 18);
+    }
+}
+
 void IS31FL3741_set_color(int index, uint8_t red, uint8_t green, uint8_t blue) {
     is31_led led;
     if (index >= 0 && index < DRIVER_LED_TOTAL) {
         memcpy_P(&led, (&g_is31_leds[index]), sizeof(led));
 
-        g_pwm_buffer[led.driver][led.r]          = red;
-        g_pwm_buffer[led.driver][led.g]          = green;
-        g_pwm_buffer[led.driver][led.b]          = blue;
-        g_pwm_buffer_update_required[led.driver] = true;
+        IS31FL3741_set_pwm(led.driver, led.r, red);
+        IS31FL3741_set_pwm(led.driver, led.g, green);
+        IS31FL3741_set_pwm(led.driver, led.b, blue);
     }
 }
 
@@ -217,19 +218,18 @@ void IS31FL3741_set_led_control_register(uint8_t index, bool red, bool green, bo
 }
 
 void IS31FL3741_update_pwm_buffers(uint8_t addr, uint8_t index) {
-    if (g_pwm_buffer_update_required[index]) {
-        IS31FL3741_write_pwm_buffer(addr, g_pwm_buffer[index]);
+    if (g_pwm_buffer_dirty[index]) {
+        // The blocks stay dirty so they are sent again with the next update
+        if (!IS31FL3741_write_pwm_blocks(addr, g_pwm_buffer[index], g_pwm_buffer_dirty[index])) return;
     }
 
-    g_pwm_buffer_update_required[index] = false;
+    g_pwm_buffer_dirty[index] = 0;
 }
 
 void IS31FL3741_set_pwm_buffer(const is31_led *pled, uint8_t red, uint8_t green, uint8_t blue) {
-    g_pwm_buffer[pled->driver][pled->r] = red;
-    g_pwm_buffer[pled->driver][pled->g] = green;
-    g_pwm_buffer[pled->driver][pled->b] = blue;
-
-    g_pwm_buffer_update_required[pled->driver] = true;
+    IS31FL3741_set_pwm(pled->driver, pled->r, red);
+    IS31FL3741_set_pwm(pled->driver, pled->g, green);
+    IS31FL3741_set_pwm(pled->driver, pled->b, blue);
 }
 
 void IS31FL3741_update_led_control_registers(uint8_t addr, uint8_t index) {
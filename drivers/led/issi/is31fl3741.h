@@ -44,7 +44,7 @@ void IS31FL3741_set_led_control_register(uint8_t index, bool red, bool green, bo
 // This should not be called from an interrupt
 // (eg. from a timer interrupt).
 // Call this while idle (in between matrix scans).
-// If the buffer is dirty, it will update the driver with the buffer.
+// Only the 18 byte blocks of the buffer that changed since the last update are sent.
 void IS31FL3741_update_pwm_buffers(uint8_t addr, uint8_t index);
 void IS31FL3741_update_led_control_registers(uint8_t addr, uint8_t index);
 void IS31FL3741_set_scaling_registers(const is31_led *pled, uint8_t red, uint8_t green, uint8_t blue);
@@ -0,0 +1,210 @@
+/* Copyright 2022 QMK
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <vector>
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "mock.h"
+#if defined(IS31FL3731)
+#    include "is31fl3731.h"
+#elif defined(IS31FL3733)
+#    include "is31fl3733.h"
+#elif defined(IS31FL3737)
+#    include "is31fl3737.h"
+#elif defined(IS31FL3741)
+#    include "is31fl3741.h"
+#elif defined(CKLED2001)
+#    include "ckled2001.h"
+#endif
+}
+
+// The first PWM register, the registers in each block and whether failed writes are kept for the next update
+#if defined(IS31FL3731)
+#    define PWM_BASE 0x24
+#    define BLOCK_SIZE 16
+#    define KEEPS_FAILED_BLOCKS 0
+#    define driver_set_color IS31FL3731_set_color
+#    define driver_update_pwm_buffers IS31FL3731_update_pwm_buffers
+#elif defined(IS31FL3733)
+#    define PWM_BASE 0x00
+#    define BLOCK_SIZE 16
+#    define KEEPS_FAILED_BLOCKS 1
+#    define driver_set_color IS31FL3733_set_color
+#    define driver_update_pwm_buffers IS31FL3733_update_pwm_buffers
+#elif defined(IS31FL3737)
+#    define PWM_BASE 0x00
+#    define BLOCK_SIZE 16
+#    define KEEPS_FAILED_BLOCKS 0
+#    define driver_set_color IS31FL3737_set_color
+#    define driver_update_pwm_buffers IS31FL3737_update_pwm_buffers
+#elif defined(IS31FL3741)
+#    define PWM_BASE 0x00
+#    define BLOCK_SIZE 18
+#    define KEEPS_FAILED_BLOCKS 1
+#    define driver_set_color IS31FL3741_set_color
+#    define driver_update_pwm_buffers IS31FL3741_update_pwm_buffers
+#elif defined(CKLED2001)
+#    define PWM_BASE 0x00
+#    define BLOCK_SIZE 16
+#    define KEEPS_FAILED_BLOCKS 1
+#    define driver_set_color CKLED2001_set_color
+#    define driver_update_pwm_buffers CKLED2001_update_pwm_buffers
+#endif
+
+#define DRIVER_ADDR 0x50
+
+// The register a block starts at, the IS31FL3741 starting over at 0 on its second page
+#if defined(IS31FL3741)
+#    define block_register(block) ((block)*BLOCK_SIZE % 180)
+#else
+#    define block_register(block) (PWM_BASE + (block)*BLOCK_SIZE)
+#endif
+
+// The first LED in block 0, the second in block 2 and the third in the last block
+#if defined(IS31FL3741)
+#    define LAST_BLOCK 19
+extern "C" const is31_led PROGMEM g_is31_leds[DRIVER_LED_TOTAL] = {{0, 0, 1, 2}, {0, 36, 37, 38}, {0, 348, 349, 350}};
+#elif defined(CKLED2001)
+#    define LAST_BLOCK 11
+extern "C" const ckled2001_led PROGMEM g_ckled2001_leds[DRIVER_LED_TOTAL] = {{0, 0, 1, 2}, {0, 32, 33, 34}, {0, 189, 190, 191}};
+#elif defined(IS31FL3731)
+#    define LAST_BLOCK 8
+extern "C" const is31_led PROGMEM g_is31_leds[DRIVER_LED_TOTAL] = {{0, 0x24, 0x25, 0x26}, {0, 0x44, 0x45, 0x46}, {0, 0xB1, 0xB2, 0xB3}};
+#else
+#    define LAST_BLOCK 11
+extern "C" const is31_led PROGMEM g_is31_leds[DRIVER_LED_TOTAL] = {{0, 0, 1, 2}, {0, 32, 33, 34}, {0, 189, 190, 191}};
+#endif
+
+class LedDriver : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        // Start every test from a dark display the driver knows is up to date
+        i2c_mock_reset();
+        for (int i = 0; i < DRIVER_LED_TOTAL; i++) {
+            driver_set_color(i, 0, 0, 0);
+        }
+        driver_update_pwm_buffers(DRIVER_ADDR, 0);
+        i2c_mock_reset();
+    }
+};
+
+TEST_F(LedDriver, UnchangedColorsSendNothing) {
+    driver_set_color(1, 10, 20, 30);
+    driver_update_pwm_buffers(DRIVER_ADDR, 0);
+    i2c_mock_reset();
+
+    driver_set_color(0, 0, 0, 0);
+    driver_set_color(1, 10, 20, 30);
+    driver_update_pwm_buffers(DRIVER_ADDR, 0);
+    EXPECT_EQ(i2c_mock_transfer_count, 0);
+}
+
+TEST_F(LedDriver, ChangedLedSendsOnlyItsBlock) {
+    driver_set_color(1, 10, 20, 30);
+    driver_update_pwm_buffers(DRIVER_ADDR, 0);
+
+    ASSERT_EQ(i2c_mock_data_transfer_count(), 1);
+    const i2c_mock_transfer_t *transfer = i2c_mock_data_transfer(0);
+    EXPECT_EQ(transfer->address, DRIVER_ADDR << 1);
+    EXPECT_EQ(transfer->length, BLOCK_SIZE + 1);
+    EXPECT_EQ(transfer->data[0], block_register(2));
+    EXPECT_EQ(transfer->data[1], 10);
+    EXPECT_EQ(transfer->data[2], 20);
+    EXPECT_EQ(transfer->data[3], 30);
+}
+
+TEST_F(LedDriver, BlocksAreSentInOrder) {
+    driver_set_color(2, 1, 1, 1);
+    driver_set_color(0, 1, 1, 1);
+    driver_update_pwm_buffers(DRIVER_ADDR, 0);
+
+    ASSERT_EQ(i2c_mock_data_transfer_count(), 2);
+    EXPECT_EQ(i2c_mock_data_transfer(0)->data[0], block_register(0));
+    EXPECT_EQ(i2c_mock_data_transfer(1)->data[0], block_register(LAST_BLOCK));
+}
+
+#if KEEPS_FAILED_BLOCKS
+TEST_F(LedDriver, FailedWriteIsSentAgain) {
+    driver_set_color(0, 1, 2, 3);
+    driver_set_color(1, 4, 5, 6);
+    i2c_mock_fail = true;
+    driver_update_pwm_buffers(DRIVER_ADDR, 0);
+    i2c_mock_reset();
+
+    driver_update_pwm_buffers(DRIVER_ADDR, 0);
+    ASSERT_EQ(i2c_mock_data_transfer_count(), 2);
+    EXPECT_EQ(i2c_mock_data_transfer(0)->data[0], block_register(0));
+    EXPECT_EQ(i2c_mock_data_transfer(1)->data[0], block_register(2));
+
+    // Sent now, so the next update has nothing to do
+    i2c_mock_reset();
+    driver_update_pwm_buffers(DRIVER_ADDR, 0);
+    EXPECT_EQ(i2c_mock_transfer_count, 0);
+}
+#endif
+
+#if defined(IS31FL3741)
+// Writes to the command register select the page the following PWM bursts land on
+static std::vector<uint8_t> selected_pages() {
+    std::vector<uint8_t> pages;
+
+    for (uint16_t i = 0; i < i2c_mock_transfer_count; i++) {
+        if (i2c_mock_transfers[i].length == 2 && i2c_mock_transfers[i].data[0] == 0xFD) pages.push_back(i2c_mock_transfers[i].data[1]);
+    }
+    return pages;
+}
+
+TEST_F(LedDriver, PageIsSelectedOnlyWhenNeeded) {
+    driver_set_color(1, 1, 1, 1);
+    driver_update_pwm_buffers(DRIVER_ADDR, 0);
+    EXPECT_EQ(selected_pages(), std::vector<uint8_t>({0}));
+
+    i2c_mock_reset();
+    driver_set_color(2, 1, 1, 1);
+    driver_update_pwm_buffers(DRIVER_ADDR, 0);
+    EXPECT_EQ(selected_pages(), std::vector<uint8_t>({1}));
+
+    i2c_mock_reset();
+    driver_set_color(0, 2, 2, 2);
+    driver_set_color(1, 2, 2, 2);
+    driver_set_color(2, 2, 2, 2);
+    driver_update_pwm_buffers(DRIVER_ADDR, 0);
+    EXPECT_EQ(selected_pages(), std::vector<uint8_t>({0, 1}));
+    EXPECT_EQ(i2c_mock_data_transfer_count(), 3);
+}
+
+TEST_F(LedDriver, LastBlockIsNineBytes) {
+    driver_set_color(2, 7, 8, 9);
+    driver_update_pwm_buffers(DRIVER_ADDR, 0);
+
+    ASSERT_EQ(i2c_mock_data_transfer_count(), 1);
+    const i2c_mock_transfer_t *transfer = i2c_mock_data_transfer(0);
+    EXPECT_EQ(transfer->length, 10);
+    EXPECT_EQ(transfer->data[0], 162);
+    EXPECT_EQ(transfer->data[7], 7);
+    EXPECT_EQ(transfer->data[8], 8);
+    EXPECT_EQ(transfer->data[9], 9);
+}
+
+TEST_F(LedDriver, WholeBufferWriteSendsEveryBlock) {
+    uint8_t pwm_buffer[351] = {0};
+
+    EXPECT_TRUE(IS31FL3741_write_pwm_buffer(DRIVER_ADDR, pwm_buffer));
+    EXPECT_EQ(i2c_mock_data_transfer_count(), 20);
+    EXPECT_EQ(selected_pages(), std::vector<uint8_t>({0, 1}));
+}
+#endif
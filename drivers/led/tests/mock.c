@@ -0,0 +1,55 @@
+/* Copyright 2022 QMK
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <string.h>
+#include "mock.h"
+
+i2c_mock_transfer_t i2c_mock_transfers[I2C_MOCK_MAX_TRANSFERS];
+uint16_t            i2c_mock_transfer_count = 0;
+bool                i2c_mock_fail           = false;
+
+void i2c_mock_reset(void) {
+    i2c_mock_transfer_count = 0;
+    i2c_mock_fail           = false;
+}
+
+i2c_status_t i2c_transmit(uint8_t address, const uint8_t *data, uint16_t length, uint16_t timeout) {
+    if (i2c_mock_transfer_count < I2C_MOCK_MAX_TRANSFERS) {
+        i2c_mock_transfer_t *transfer = &i2c_mock_transfers[i2c_mock_transfer_count];
+
+        transfer->address = address;
+        transfer->length  = length;
+        memcpy(transfer->data, data, length < sizeof(transfer->data) ? length : sizeof(transfer->data));
+    }
+    i2c_mock_transfer_count++;
+    return i2c_mock_fail ? I2C_STATUS_ERROR : I2C_STATUS_SUCCESS;
+}
+
+uint16_t i2c_mock_data_transfer_count(void) {
+    uint16_t count = 0;
+
+    for (uint16_t i = 0; i < i2c_mock_transfer_count && i < I2C_MOCK_MAX_TRANSFERS; i++) {
+        if (i2c_mock_transfers[i].length > 2) count++;
+    }
+    return count;
+}
+
+const i2c_mock_transfer_t *i2c_mock_data_transfer(uint16_t index) {
+    for (uint16_t i = 0; i < i2c_mock_transfer_count && i < I2C_MOCK_MAX_TRANSFERS; i++) {
+        if (i2c_mock_transfers[i].length > 2 && index-- == 0) return &i2c_mock_transfers[i];
+    }
+    return NULL;
+}
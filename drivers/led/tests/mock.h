@@ -0,0 +1,42 @@
+/* Copyright 2022 QMK
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "i2c_master.h"
+
+#define I2C_MOCK_MAX_TRANSFERS 64
+
+// Records every i2c_transmit() instead of sending it, so the tests can see
+// which registers the LED drivers write. Single register writes are two bytes
+// long, anything longer is a burst of PWM data.
+typedef struct i2c_mock_transfer_t {
+    uint8_t  address;
+    uint16_t length;
+    uint8_t  data[20];
+} i2c_mock_transfer_t;
+
+extern i2c_mock_transfer_t i2c_mock_transfers[I2C_MOCK_MAX_TRANSFERS];
+extern uint16_t            i2c_mock_transfer_count;
+// Every transfer fails while this is set, and is recorded all the same
+extern bool i2c_mock_fail;
+
+void i2c_mock_reset(void);
+
+uint16_t                   i2c_mock_data_transfer_count(void);
+const i2c_mock_transfer_t *i2c_mock_data_transfer(uint16_t index);
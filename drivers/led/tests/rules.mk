@@ -0,0 +1,56 @@
+# Copyright 2022 QMK
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 2 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+LED_DRIVER_COMMON_CONFIG := $(DRIVER_PATH)/led/tests/config.h
+
+LED_DRIVER_COMMON_INC := \
+	$(DRIVER_PATH)/led/tests \
+	$(DRIVER_PATH)/led/issi \
+	$(DRIVER_PATH)/led
+
+LED_DRIVER_COMMON_SRC := \
+	$(DRIVER_PATH)/led/tests/mock.c \
+	$(DRIVER_PATH)/led/tests/led_driver_tests.cpp \
+	$(PLATFORM_PATH)/test/timer.c
+
+led_driver_is31fl3731_DEFS := -DIS31FL3731
+led_driver_is31fl3731_CONFIG := $(LED_DRIVER_COMMON_CONFIG)
+led_driver_is31fl3731_INC := $(LED_DRIVER_COMMON_INC)
+led_driver_is31fl3731_SRC := $(LED_DRIVER_COMMON_SRC) \
+	$(DRIVER_PATH)/led/issi/is31fl3731.c
+
+led_driver_is31fl3733_DEFS := -DIS31FL3733
+led_driver_is31fl3733_CONFIG := $(LED_DRIVER_COMMON_CONFIG)
+led_driver_is31fl3733_INC := $(LED_DRIVER_COMMON_INC)
+led_driver_is31fl3733_SRC := $(LED_DRIVER_COMMON_SRC) \
+	$(DRIVER_PATH)/led/issi/is31fl3733.c
+
+led_driver_is31fl3737_DEFS := -DIS31FL3737
+led_driver_is31fl3737_CONFIG := $(LED_DRIVER_COMMON_CONFIG)
+led_driver_is31fl3737_INC := $(LED_DRIVER_COMMON_INC)
+led_driver_is31fl3737_SRC := $(LED_DRIVER_COMMON_SRC) \
+	$(DRIVER_PATH)/led/issi/is31fl3737.c
+
+led_driver_is31fl3741_DEFS := -DIS31FL3741
+led_driver_is31fl3741_CONFIG := $(LED_DRIVER_COMMON_CONFIG)
+led_driver_is31fl3741_INC := $(LED_DRIVER_COMMON_INC)
+led_driver_is31fl3741_SRC := $(LED_DRIVER_COMMON_SRC) \
+	$(DRIVER_PATH)/led/issi/is31fl3741.c
+
+led_driver_ckled2001_DEFS := -DCKLED2001
+led_driver_ckled2001_CONFIG := $(LED_DRIVER_COMMON_CONFIG)
+led_driver_ckled2001_INC := $(LED_DRIVER_COMMON_INC)
+led_driver_ckled2001_SRC := $(LED_DRIVER_COMMON_SRC) \
+	$(DRIVER_PATH)/led/ckled2001.c
@@ -0,0 +1,6 @@
+TEST_LIST += \
+	led_driver_is31fl3731 \
+	led_driver_is31fl3733 \
+	led_driver_is31fl3737 \
+	led_driver_is31fl3741 \
+	led_driver_ckled2001
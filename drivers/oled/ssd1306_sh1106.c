@@ -92,15 +92,40 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 
 #define OLED_ALL_BLOCKS_MASK (((((OLED_BLOCK_TYPE)1 << (OLED_BLOCK_COUNT - 1)) - 1) << 1) | 1)
 
+// Rendering defines
+#ifdef OLED_RENDER_ASYNC
+#    ifndef PROTOCOL_CHIBIOS
+#        error "OLED_RENDER_ASYNC is only supported on ChibiOS"
+#    elif !I2C_USE_MUTUAL_EXCLUSION
+// The render thread shares the bus with every other I2C user, which only i2c_master's bus locking keeps apart
+#        error "OLED_RENDER_ASYNC requires I2C_USE_MUTUAL_EXCLUSION to be enabled in halconf.h"
+#    endif
+#endif
+#ifndef OLED_RENDER_BURST_BLOCKS
+#    ifdef OLED_RENDER_ASYNC
+#        define OLED_RENDER_BURST_BLOCKS OLED_BLOCK_COUNT
+#    else
+#        define OLED_RENDER_BURST_BLOCKS 1
+#    endif
+#endif
+#ifndef OLED_RENDER_BUDGET
+#    define OLED_RENDER_BUDGET 0
+#endif
+
 // i2c defines
 #define I2C_CMD 0x00
 #define I2C_DATA 0x40
 #if defined(__AVR__)
 #    define I2C_TRANSMIT_P(data) i2c_transmit_P((OLED_DISPLAY_ADDRESS << 1), &data[0], sizeof(data), OLED_I2C_TIMEOUT)
 #else  // defined(__AVR__)
-#    define I2C_TRANSMIT_P(data) i2c_transmit((OLED_DISPLAY_ADDRESS << 1), &data[0], sizeof(data), OLED_I2C_TIMEOUT)
+#    define I2C_TRANSMIT_P(data) I2C_TRANSMIT(data)
 #endif  // defined(__AVR__)
-#define I2C_TRANSMIT(data) i2c_transmit((OLED_DISPLAY_ADDRESS << 1), &data[0], sizeof(data), OLED_I2C_TIMEOUT)
+#ifdef OLED_RENDER_ASYNC
+// Commands wait for any render still being sent in the background
+#    define I2C_TRANSMIT(data) oled_i2c_transmit(&data[0], sizeof(data))
+#else
+#    define I2C_TRANSMIT(data) i2c_transmit((OLED_DISPLAY_ADDRESS << 1), &data[0], sizeof(data), OLED_I2C_TIMEOUT)
+#endif
 #define I2C_WRITE_REG(mode, data, size) i2c_writeReg((OLED_DISPLAY_ADDRESS << 1), mode, data, size, OLED_I2C_TIMEOUT)
 
 #define HAS_FLAGS(bits, flags) ((bits & flags) == flags)
@@ -134,6 +159,42 @@ uint16_t oled_update_timeout;
 
 // Internal variables to reduce math instructions
 
+#ifdef OLED_RENDER_ASYNC
+#    include <ch.h>
+
+// Held by whoever is using the bus, the render thread included
+static BSEMAPHORE_DECL(oled_bus_idle, false);
+static BSEMAPHORE_DECL(oled_job_ready, true);
+
+static uint8_t                  oled_job_command[7];
+static const uint8_t *          oled_job_data;
+static uint16_t                 oled_job_length;
+static OLED_BLOCK_TYPE          oled_job_blocks;
+static volatile OLED_BLOCK_TYPE oled_job_failed = 0;
+
+static THD_WORKING_AREA(waOledRenderThread, 256 + OLED_MATRIX_SIZE);
+static THD_FUNCTION(OledRenderThread, arg) {
+    (void)arg;
+    chRegSetThreadName("oled_render");
+
+    while (true) {
+        chBSemWait(&oled_job_ready);
+        if (i2c_transmit((OLED_DISPLAY_ADDRESS << 1), oled_job_command, sizeof(oled_job_command), OLED_I2C_TIMEOUT) != I2C_STATUS_SUCCESS || I2C_WRITE_REG(I2C_DATA, oled_job_data, oled_job_length) != I2C_STATUS_SUCCESS) {
+            // Picked up by the next oled_render(), which sends these blocks again
+            oled_job_failed |= oled_job_blocks;
+        }
+        chBSemSignal(&oled_bus_idle);
+    }
+}
+
+static i2c_status_t oled_i2c_transmit(const uint8_t *data, uint16_t length) {
+    chBSemWait(&oled_bus_idle);
+    i2c_status_t status = i2c_transmit((OLED_DISPLAY_ADDRESS << 1), data, length, OLED_I2C_TIMEOUT);
+    chBSemSignal(&oled_bus_idle);
+    return status;
+}
+#endif
+
 #if defined(__AVR__)
 // identical to i2c_transmit, but for PROGMEM since all initialization is in PROGMEM arrays currently
 // probably should move this into i2c_master...
@@ -175,6 +236,16 @@ bool oled_init(oled_rotation_t rotation) {
     }
     i2c_init();
 
+#ifdef OLED_RENDER_ASYNC
+    static bool render_thread_started = false;
+    if (!render_thread_started) {
+        render_thread_started = true;
+        // Above the main loop, which never yields without round-robin, so a handed over render starts at once.
+        // The thread gives the CPU back while it waits on the I2C transfer.
+        chThdCreateStatic(waOledRenderThread, sizeof(waOledRenderThread), NORMALPRIO + 1, OledRenderThread, NULL);
+    }
+#endif
+
     static const uint8_t PROGMEM display_setup1[] = {
         I2C_CMD,
         DISPLAY_OFF,
@@ -241,10 +312,12 @@ void oled_clear(void) {
     oled_dirty  = OLED_ALL_BLOCKS_MASK;
 }
 
-static void calc_bounds(uint8_t update_start, uint8_t *cmd_array) {
+static void calc_bounds(uint8_t update_start, uint8_t update_count, uint8_t *cmd_array) {
     // Calculate commands to set memory addressing bounds.
-    uint8_t start_page   = OLED_BLOCK_SIZE * update_start / OLED_DISPLAY_WIDTH;
-    uint8_t start_column = OLED_BLOCK_SIZE * update_start % OLED_DISPLAY_WIDTH;
+    uint16_t start_index  = OLED_BLOCK_SIZE * update_start;
+    uint16_t end_index    = start_index + OLED_BLOCK_SIZE * update_count - 1;
+    uint8_t  start_page   = start_index / OLED_DISPLAY_WIDTH;
+    uint8_t  start_column = start_index % OLED_DISPLAY_WIDTH;
 #if (OLED_IC == OLED_IC_SH1106)
     // Commands for Page Addressing Mode. Sets starting page and column; has no end bound.
     // Column value must be split into high and low nybble and sent as two commands.
@@ -256,10 +329,16 @@ static void calc_bounds(uint8_t update_start, uint8_t *cmd_array) {
     cmd_array[5] = NOP;
 #else
     // Commands for use in Horizontal Addressing mode.
+    // A range spanning several pages starts at column 0, so it wraps around the full width.
     cmd_array[1] = start_column;
     cmd_array[4] = start_page;
-    cmd_array[2] = (OLED_BLOCK_SIZE + OLED_DISPLAY_WIDTH - 1) % OLED_DISPLAY_WIDTH + cmd_array[1];
-    cmd_array[5] = (OLED_BLOCK_SIZE + OLED_DISPLAY_WIDTH - 1) / OLED_DISPLAY_WIDTH - 1;
+    if (end_index / OLED_DISPLAY_WIDTH == start_page) {
+        cmd_array[2] = end_index % OLED_DISPLAY_WIDTH;
+        cmd_array[5] = start_page;
+    } else {
+        cmd_array[2] = OLED_DISPLAY_WIDTH - 1;
+        cmd_array[5] = end_index / OLED_DISPLAY_WIDTH;
+    }
 #endif
 }
 
@@ -271,32 +350,84 @@ static void calc_bounds_90(uint8_t update_start, uint8_t *cmd_array) {
     cmd_array[5] = (OLED_BLOCK_SIZE + OLED_DISPLAY_HEIGHT - 1) % OLED_DISPLAY_HEIGHT / 8;
 }
 
-uint8_t crot(uint8_t a, int8_t n) {
-    const uint8_t mask = 0x7;
-    n &= mask;
-    return a << n | a >> (-n & mask);
+// Whether the block after a run of dirty blocks can be sent in the same burst.
+// The display only wraps to the next page at the column the burst started on.
+static bool can_extend_burst(uint8_t update_start, uint8_t next_block) {
+    uint8_t start_page = OLED_BLOCK_SIZE * update_start / OLED_DISPLAY_WIDTH;
+    uint8_t end_page   = (OLED_BLOCK_SIZE * (next_block + 1) - 1) / OLED_DISPLAY_WIDTH;
+#if (OLED_IC == OLED_IC_SH1106)
+    // Page Addressing Mode never leaves the page
+    return end_page == start_page;
+#else
+    return end_page == start_page || OLED_BLOCK_SIZE * update_start % OLED_DISPLAY_WIDTH == 0;
+#endif
 }
 
+// Transposes an 8x8 block of pixels, rotating it by 90 degrees.
+// Works on two 32-bit words at a time, see Hacker's Delight, 7-3.
 static void rotate_90(const uint8_t *src, uint8_t *dest) {
-    for (uint8_t i = 0, shift = 7; i < 8; ++i, --shift) {
-        uint8_t selector = (1 << i);
-        for (uint8_t j = 0; j < 8; ++j) {
-            dest[i] |= crot(src[j] & selector, shift - (int8_t)j);
-        }
+    uint32_t x = (uint32_t)src[0] << 24 | (uint32_t)src[1] << 16 | (uint32_t)src[2] << 8 | src[3];
+    uint32_t y = (uint32_t)src[4] << 24 | (uint32_t)src[5] << 16 | (uint32_t)src[6] << 8 | src[7];
+    uint32_t t;
+
+    t = (x ^ (x >> 7)) & 0x00AA00AA;
+    x = x ^ t ^ (t << 7);
+    t = (y ^ (y >> 7)) & 0x00AA00AA;
+    y = y ^ t ^ (t << 7);
+
+    t = (x ^ (x >> 14)) & 0x0000CCCC;
+    x = x ^ t ^ (t << 14);
+    t = (y ^ (y >> 14)) & 0x0000CCCC;
+    y = y ^ t ^ (t << 14);
+
+    t = (x & 0xF0F0F0F0) | ((y >> 4) & 0x0F0F0F0F);
+    y = ((x << 4) & 0xF0F0F0F0) | (y & 0x0F0F0F0F);
+    x = t;
+
+    dest[0] |= y;
+    dest[1] |= y >> 8;
+    dest[2] |= y >> 16;
+    dest[3] |= y >> 24;
+    dest[4] |= x;
+    dest[5] |= x >> 8;
+    dest[6] |= x >> 16;
+    dest[7] |= x >> 24;
+}
+
+// Sends the addressing command, then the data. Returns false if it could not, leaving the blocks dirty.
+static bool oled_render_send(uint8_t *command, const uint8_t *data, uint16_t length, OLED_BLOCK_TYPE blocks) {
+#ifdef OLED_RENDER_ASYNC
+    // Still sending the last burst, try again next time
+    if (chBSemWaitTimeout(&oled_bus_idle, TIME_IMMEDIATE) != MSG_OK) {
+        return false;
     }
-}
-
-void oled_render(void) {
-    if (!oled_initialized) {
-        return;
+    memcpy(oled_job_command, command, sizeof(oled_job_command));
+    oled_job_data   = data;
+    oled_job_length = length;
+    oled_job_blocks = blocks;
+    // Blocks drawn to while they are being sent are marked dirty again, and go out with a later burst
+    oled_dirty &= ~blocks;
+    chBSemSignal(&oled_job_ready);
+#else
+    // Send column & page position
+    if (i2c_transmit((OLED_DISPLAY_ADDRESS << 1), command, 7, OLED_I2C_TIMEOUT) != I2C_STATUS_SUCCESS) {
+        print("oled_render offset command failed\n");
+        return false;
     }
 
-    // Do we have work to do?
-    oled_dirty &= OLED_ALL_BLOCKS_MASK;
-    if (!oled_dirty || oled_scrolling) {
-        return;
+    if (I2C_WRITE_REG(I2C_DATA, data, length) != I2C_STATUS_SUCCESS) {
+        print("oled_render data failed\n");
+        return false;
     }
 
+    // Clear dirty flag
+    oled_dirty &= ~blocks;
+#endif
+    return true;
+}
+
+// Sends the first dirty block, along with as many of the dirty blocks following it as fit in one burst
+static bool oled_render_burst(void) {
     // Find first dirty block
     uint8_t update_start = 0;
     while (!(oled_dirty & ((OLED_BLOCK_TYPE)1 << update_start))) {
@@ -305,47 +436,84 @@ void oled_render(void) {
 
     // Set column & page position
     static uint8_t display_start[] = {I2C_CMD, COLUMN_ADDR, 0, OLED_DISPLAY_WIDTH - 1, PAGE_ADDR, 0, OLED_DISPLAY_HEIGHT / 8 - 1};
-    if (!HAS_FLAGS(oled_rotation, OLED_ROTATION_90)) {
-        calc_bounds(update_start, &display_start[1]);  // Offset from I2C_CMD byte at the start
-    } else {
-        calc_bounds_90(update_start, &display_start[1]);  // Offset from I2C_CMD byte at the start
-    }
-
-    // Send column & page position
-    if (I2C_TRANSMIT(display_start) != I2C_STATUS_SUCCESS) {
-        print("oled_render offset command failed\n");
-        return;
-    }
 
     if (!HAS_FLAGS(oled_rotation, OLED_ROTATION_90)) {
-        // Send render data chunk as is
-        if (I2C_WRITE_REG(I2C_DATA, &oled_buffer[OLED_BLOCK_SIZE * update_start], OLED_BLOCK_SIZE) != I2C_STATUS_SUCCESS) {
-            print("oled_render data failed\n");
-            return;
+        uint8_t         update_count = 1;
+        OLED_BLOCK_TYPE blocks       = (OLED_BLOCK_TYPE)1 << update_start;
+        while (update_count < OLED_RENDER_BURST_BLOCKS && update_start + update_count < OLED_BLOCK_COUNT) {
+            OLED_BLOCK_TYPE next = (OLED_BLOCK_TYPE)1 << (update_start + update_count);
+            if (!(oled_dirty & next) || !can_extend_burst(update_start, update_start + update_count)) {
+                break;
+            }
+            blocks |= next;
+            ++update_count;
         }
+
+        calc_bounds(update_start, update_count, &display_start[1]);  // Offset from I2C_CMD byte at the start
+
+        // Send render data as is
+        return oled_render_send(display_start, &oled_buffer[OLED_BLOCK_SIZE * update_start], OLED_BLOCK_SIZE * update_count, blocks);
     } else {
+        calc_bounds_90(update_start, &display_start[1]);  // Offset from I2C_CMD byte at the start
+
         // Rotate the render chunks
         const static uint8_t source_map[] = OLED_SOURCE_MAP;
         const static uint8_t target_map[] = OLED_TARGET_MAP;
 
         static uint8_t temp_buffer[OLED_BLOCK_SIZE];
+#ifdef OLED_RENDER_ASYNC
+        // The render thread may still be sending the last rotated block from here
+        if (chBSemWaitTimeout(&oled_bus_idle, TIME_IMMEDIATE) != MSG_OK) {
+            return false;
+        }
+        chBSemSignal(&oled_bus_idle);
+#endif
         memset(temp_buffer, 0, sizeof(temp_buffer));
         for (uint8_t i = 0; i < sizeof(source_map); ++i) {
             rotate_90(&oled_buffer[OLED_BLOCK_SIZE * update_start + source_map[i]], &temp_buffer[target_map[i]]);
         }
 
         // Send render data chunk after rotating
-        if (I2C_WRITE_REG(I2C_DATA, &temp_buffer[0], OLED_BLOCK_SIZE) != I2C_STATUS_SUCCESS) {
-            print("oled_render90 data failed\n");
+        return oled_render_send(display_start, &temp_buffer[0], OLED_BLOCK_SIZE, (OLED_BLOCK_TYPE)1 << update_start);
+    }
+}
+
+void oled_render(void) {
+    if (!oled_initialized) {
+        return;
+    }
+
+#ifdef OLED_RENDER_ASYNC
+    if (oled_job_failed) {
+        chSysLock();
+        oled_dirty |= oled_job_failed;
+        oled_job_failed = 0;
+        chSysUnlock();
+    }
+#endif
+
+    // Do we have work to do?
+    oled_dirty &= OLED_ALL_BLOCKS_MASK;
+    if (!oled_dirty || oled_scrolling) {
+        return;
+    }
+
+#if OLED_RENDER_BUDGET > 0 && !defined(OLED_RENDER_ASYNC)
+    // Keep sending bursts until the time is up
+    uint32_t render_start = timer_read32();
+    do {
+        if (!oled_render_burst()) {
             return;
         }
+    } while (oled_dirty && timer_elapsed32(render_start) < OLED_RENDER_BUDGET);
+#else
+    if (!oled_render_burst()) {
+        return;
     }
+#endif
 
     // Turn on display if it is off
     oled_on();
-
-    // Clear dirty flag
-    oled_dirty &= ~((OLED_BLOCK_TYPE)1 << update_start);
 }
 
 void oled_set_cursor(uint8_t col, uint8_t line) {
@@ -78,13 +78,13 @@ int16_t pimoroni_trackball_get_offsets(uint8_t negative_dir, uint8_t positive_di
     return isnegative ? -(int16_t)(magnitude) : (int16_t)(magnitude);
 }
 
-void pimoroni_trackball_adapt_values(int8_t* mouse, int16_t* offset) {
-    if (*offset > 127) {
-        *mouse = 127;
-        *offset -= 127;
-    } else if (*offset < -127) {
-        *mouse = -127;
-        *offset += 127;
+void pimoroni_trackball_adapt_values(mouse_xy_report_t* mouse, int16_t* offset) {
+    if (*offset > MOUSE_REPORT_XY_MAX) {
+        *mouse = MOUSE_REPORT_XY_MAX;
+        *offset -= MOUSE_REPORT_XY_MAX;
+    } else if (*offset < -MOUSE_REPORT_XY_MAX) {
+        *mouse = -MOUSE_REPORT_XY_MAX;
+        *offset += MOUSE_REPORT_XY_MAX;
     } else {
         *mouse  = *offset;
         *offset = 0;
@@ -15,6 +15,7 @@
 
 #pragma once
 
+#include <stdbool.h>
 #include "quantum/color.h"
 
 /*
@@ -68,3 +69,13 @@
  *         - Wait 50us to reset the LEDs
  */
 void ws2812_setleds(LED_TYPE *ledarray, uint16_t number_of_leds);
+
+/*
+ * Returns false while the previous frame is still being sent by DMA, in which case
+ * ws2812_setleds() would have to wait for it. Drivers that send synchronously are always ready.
+ */
+#ifdef WS2812_DRIVER_SPI
+bool ws2812_ready(void);
+#else
+static inline bool ws2812_ready(void) { return true; }
+#endif
@@ -1,5 +1,6 @@
 """Used by the make system to generate info_config.h from info.json.
 """
+import re
 from pathlib import Path
 
 from dotty_dict import dotty
@@ -56,6 +57,38 @@ def pin_array(define, pins, postfix):
 """
 
 
+def col_port_map(cols):
+    """Return the config.h lines that set MATRIX_COL_PORT_MAP, or an empty string if the column pins can not be grouped by port.
+    """
+    ports = {}
+    segments = {}
+
+    for col, pin in enumerate(cols):
+        if not pin:
+            continue
+
+        match = re.fullmatch(r'([A-Z]+)(\d+)', pin)
+        if not match or int(match.group(2)) > 31:
+            return ''
+
+        port, bit = match.group(1), int(match.group(2))
+        ports.setdefault(port, pin)
+        key = (port, bit - col)
+        segments[key] = segments.get(key, 0) | (1 << bit)
+
+    entries = []
+    for port, pin in ports.items():
+        for (segment_port, shift), mask in segments.items():
+            if segment_port == port:
+                entries.append(f'{{{pin}, 0x{mask:X}, {shift}}}')
+
+    return f"""
+#ifndef MATRIX_COL_PORT_MAP
+#   define MATRIX_COL_PORT_MAP {{ {", ".join(entries)} }}
+#endif // MATRIX_COL_PORT_MAP
+"""
+
+
 def matrix_pins(matrix_pins, postfix=''):
     """Add the matrix config to the config.h.
     """
@@ -67,6 +100,9 @@ def matrix_pins(matrix_pins, postfix=''):
     if 'cols' in matrix_pins:
         pins.append(pin_array('MATRIX_COL', matrix_pins['cols'], postfix))
 
+        if matrix_pins.get('port_read') and not postfix:
+            pins.append(col_port_map(matrix_pins['cols']))
+
     if 'rows' in matrix_pins:
         pins.append(pin_array('MATRIX_ROW', matrix_pins['rows'], postfix))
 
@@ -17,3 +17,6 @@
 
 // The platform is 8-bit, so prefer 16-bit timers to reduce code size
 #define FAST_TIMER_T_SIZE 16
+
+// Timer0 counts through each millisecond, so timer_read_us() can read between ticks
+#define TIMER_US_SUPPORTED
@@ -124,6 +124,38 @@ inline uint32_t timer_elapsed32(uint32_t last) {
     return TIMER_DIFF_32(t, last);
 }
 
+#if defined(__AVR_ATmega32A__)
+#    define TIMER_COMPARE_PENDING() (TIFR & _BV(OCF0))
+#elif defined(__AVR_ATtiny85__)
+#    define TIMER_COMPARE_PENDING() (TIFR & _BV(OCF0A))
+#else
+#    define TIMER_COMPARE_PENDING() (TIFR0 & _BV(OCF0A))
+#endif
+
+/** \brief timer read microseconds
+ *
+ * Combines the millisecond count with timer0's position within the millisecond.
+ */
+uint32_t timer_read_us(void) {
+    uint32_t ms;
+    uint8_t  raw;
+
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+        ms  = timer_count;
+        raw = TIMER_RAW;
+        // timer0 has started the next millisecond, but its interrupt has not counted it yet
+        if (TIMER_COMPARE_PENDING() && raw < TIMER_RAW_TOP) ms++;
+    }
+
+    return ms * 1000 + (uint32_t)raw * 1000000 / TIMER_RAW_FREQ;
+}
+
+/** \brief timer elapsed microseconds
+ *
+ * Microseconds since a timer_read_us() value.
+ */
+uint32_t timer_elapsed_us(uint32_t last) { return TIMER_DIFF_32(timer_read_us(), last); }
+
 // excecuted once per 1ms.(excess for just timer count?)
 #ifndef __AVR_ATmega32A__
 #    define TIMER_INTERRUPT_VECTOR TIMER0_COMPA_vect
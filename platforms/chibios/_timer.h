@@ -15,5 +15,16 @@
  */
 #pragma once
 
+#include <ch.h>
+#include <hal.h>
+
 // The platform is 32-bit, so prefer 32-bit timers to avoid overflow
 #define FAST_TIMER_T_SIZE 32
+
+// timer_read_us() counts with the core's cycle counter where ChibiOS has one, and otherwise with the system tick if it runs at 10 kHz or more
+#if PORT_SUPPORTS_RT == TRUE && defined(STM32_HCLK) && STM32_HCLK % 1000000 == 0
+#    define TIMER_US_REALTIME_COUNTER
+#    define TIMER_US_SUPPORTED
+#elif CH_CFG_ST_FREQUENCY >= 10000 && 1000000 % CH_CFG_ST_FREQUENCY == 0
+#    define TIMER_US_SUPPORTED
+#endif
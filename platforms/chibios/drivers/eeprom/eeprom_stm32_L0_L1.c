@@ -67,7 +67,7 @@ void eeprom_driver_erase(void) {
     STM32_L0_L1_EEPROM_Lock();
 }
 
-void eeprom_read_block(void *buf, const void *addr, size_t len) {
+void eeprom_driver_read_block(void *buf, const void *addr, size_t len) {
     for (size_t offset = 0; offset < len; ++offset) {
         // Drop out if we've hit the limit of the EEPROM
         if ((((uint32_t)addr) + offset) >= STM32_ONBOARD_EEPROM_SIZE) {
@@ -79,7 +79,7 @@ void eeprom_read_block(void *buf, const void *addr, size_t len) {
     }
 }
 
-void eeprom_write_block(const void *buf, void *addr, size_t len) {
+void eeprom_driver_write_block(const void *buf, void *addr, size_t len) {
     STM32_L0_L1_EEPROM_Unlock();
 
     for (size_t offset = 0; offset < len; ++offset) {
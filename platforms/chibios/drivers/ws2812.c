@@ -1,3 +1,4 @@
+#include <string.h>
 #include "quantum.h"
 #include "ws2812.h"
 #include <ch.h>
@@ -69,6 +70,11 @@ void sendByte(uint8_t byte) {
 
 void ws2812_init(void) { palSetLineMode(RGB_DI_PIN, WS2812_OUTPUT_MODE); }
 
+#ifdef WS2812_SKIP_UNCHANGED
+static LED_TYPE last_frame[RGBLED_NUM];
+static uint16_t last_frame_leds = 0;
+#endif
+
 // Setleds for standard RGB
 void ws2812_setleds(LED_TYPE *ledarray, uint16_t leds) {
     static bool s_init = false;
@@ -77,6 +83,17 @@ void ws2812_setleds(LED_TYPE *ledarray, uint16_t leds) {
         s_init = true;
     }
 
+#ifdef WS2812_SKIP_UNCHANGED
+    // Interrupts are off for the whole strip, so a repeated frame is not worth sending
+    if (leds == last_frame_leds && memcmp(ledarray, last_frame, leds * sizeof(LED_TYPE)) == 0) {
+        return;
+    }
+    if (leds <= RGBLED_NUM) {
+        memcpy(last_frame, ledarray, leds * sizeof(LED_TYPE));
+        last_frame_leds = leds;
+    }
+#endif
+
     // this code is very time dependent, so we need to disable interrupts
     chSysLock();
 
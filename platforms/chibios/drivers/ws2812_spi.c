@@ -1,3 +1,4 @@
+#include <string.h>
 #include "quantum.h"
 #include "ws2812.h"
 
@@ -79,8 +80,28 @@
 #define DATA_SIZE (BYTES_FOR_LED * RGBLED_NUM)
 #define RESET_SIZE (1000 * WS2812_TRST_US / (2 * WS2812_TIMING))
 #define PREAMBLE_SIZE 4
+#define TXBUF_SIZE (PREAMBLE_SIZE + DATA_SIZE + RESET_SIZE)
 
-static uint8_t txbuf[PREAMBLE_SIZE + DATA_SIZE + RESET_SIZE] = {0};
+#if defined(WS2812_SPI_DOUBLE_BUFFER) && (defined(WS2812_SPI_USE_CIRCULAR_BUFFER) || defined(WS2812_SPI_SYNC))
+#    error "WS2812_SPI_DOUBLE_BUFFER cannot be used with WS2812_SPI_USE_CIRCULAR_BUFFER or WS2812_SPI_SYNC"
+#endif
+
+#ifdef WS2812_SPI_DOUBLE_BUFFER
+// One buffer is encoded while the other one is being sent
+static uint8_t  txbufs[2][TXBUF_SIZE] = {0};
+static uint8_t* txbuf                 = txbufs[0];
+// Set while the buffer not being sent holds a frame that is waiting to go out
+static volatile bool frame_pending = false;
+#else
+static uint8_t txbuf[TXBUF_SIZE] = {0};
+#endif
+#if !defined(WS2812_SPI_USE_CIRCULAR_BUFFER) && !defined(WS2812_SPI_SYNC)
+static volatile bool frame_sending = false;
+#endif
+#ifdef WS2812_SKIP_UNCHANGED
+static LED_TYPE last_frame[RGBLED_NUM];
+static uint16_t last_frame_leds = 0;
+#endif
 
 /*
  * As the trick here is to use the SPI to send a huge pattern of 0 and 1 to
@@ -121,6 +142,27 @@ static void set_led_color_rgb(LED_TYPE color, int pos) {
 #endif
 }
 
+#if !defined(WS2812_SPI_USE_CIRCULAR_BUFFER) && !defined(WS2812_SPI_SYNC)
+static void ws2812_spi_end(SPIDriver* spip) {
+    chSysLockFromISR();
+#    ifdef WS2812_SPI_DOUBLE_BUFFER
+    if (frame_pending) {
+        // The waiting frame goes out straight away, and the buffer just sent becomes free to encode into
+        frame_pending = false;
+        spiStartSendI(spip, TXBUF_SIZE, txbuf);
+        txbuf = txbuf == txbufs[0] ? txbufs[1] : txbufs[0];
+        chSysUnlockFromISR();
+        return;
+    }
+#    endif
+    frame_sending = false;
+    chSysUnlockFromISR();
+}
+#    define WS2812_SPI_END_CB ws2812_spi_end
+#else
+#    define WS2812_SPI_END_CB NULL
+#endif
+
 void ws2812_init(void) {
     palSetLineMode(RGB_DI_PIN, WS2812_MOSI_OUTPUT_MODE);
 
@@ -129,13 +171,23 @@ void ws2812_init(void) {
 #endif  // WS2812_SPI_SCK_PIN
 
     // TODO: more dynamic baudrate
-    static const SPIConfig spicfg = {WS2812_SPI_BUFFER_MODE, NULL, PAL_PORT(RGB_DI_PIN), PAL_PAD(RGB_DI_PIN), WS2812_SPI_DIVISOR_CR1_BR_X};
+    static const SPIConfig spicfg = {WS2812_SPI_BUFFER_MODE, WS2812_SPI_END_CB, PAL_PORT(RGB_DI_PIN), PAL_PAD(RGB_DI_PIN), WS2812_SPI_DIVISOR_CR1_BR_X};
 
     spiAcquireBus(&WS2812_SPI);     /* Acquire ownership of the bus.    */
     spiStart(&WS2812_SPI, &spicfg); /* Setup transfer parameters.       */
     spiSelect(&WS2812_SPI);         /* Slave Select assertion.          */
 #ifdef WS2812_SPI_USE_CIRCULAR_BUFFER
-    spiStartSend(&WS2812_SPI, sizeof(txbuf) / sizeof(txbuf[0]), txbuf);
+    spiStartSend(&WS2812_SPI, TXBUF_SIZE, txbuf);
+#endif
+}
+
+bool ws2812_ready(void) {
+#if defined(WS2812_SPI_DOUBLE_BUFFER)
+    return !frame_pending;
+#elif !defined(WS2812_SPI_USE_CIRCULAR_BUFFER) && !defined(WS2812_SPI_SYNC)
+    return !frame_sending;
+#else
+    return true;
 #endif
 }
 
@@ -146,17 +198,46 @@ void ws2812_setleds(LED_TYPE* ledarray, uint16_t leds) {
         s_init = true;
     }
 
+#ifdef WS2812_SKIP_UNCHANGED
+    if (leds == last_frame_leds && memcmp(ledarray, last_frame, leds * sizeof(LED_TYPE)) == 0) {
+        return;
+    }
+    if (leds <= RGBLED_NUM) {
+        memcpy(last_frame, ledarray, leds * sizeof(LED_TYPE));
+        last_frame_leds = leds;
+    }
+#endif
+
+#if defined(WS2812_SPI_DOUBLE_BUFFER)
+    // A frame still waiting in the free buffer is replaced by this one
+    chSysLock();
+    frame_pending = false;
+    chSysUnlock();
+#elif !defined(WS2812_SPI_USE_CIRCULAR_BUFFER) && !defined(WS2812_SPI_SYNC)
+    // Only reached when the caller did not check ws2812_ready(); the buffer cannot change under the DMA
+    while (frame_sending) {
+    }
+#endif
+
     for (uint8_t i = 0; i < leds; i++) {
         set_led_color_rgb(ledarray[i], i);
     }
 
-    // Send async - each led takes ~0.03ms, 50 leds ~1.5ms, animations flushing faster than send will cause issues.
-    // Instead spiSend can be used to send synchronously (or the thread logic can be added back).
-#ifndef WS2812_SPI_USE_CIRCULAR_BUFFER
-#    ifdef WS2812_SPI_SYNC
-    spiSend(&WS2812_SPI, sizeof(txbuf) / sizeof(txbuf[0]), txbuf);
-#    else
-    spiStartSend(&WS2812_SPI, sizeof(txbuf) / sizeof(txbuf[0]), txbuf);
-#    endif
+    // Send async - each led takes ~0.03ms, 50 leds ~1.5ms, so callers check ws2812_ready() before flushing again.
+#if defined(WS2812_SPI_DOUBLE_BUFFER)
+    chSysLock();
+    if (frame_sending) {
+        frame_pending = true;
+    } else {
+        frame_sending = true;
+        spiStartSendI(&WS2812_SPI, TXBUF_SIZE, txbuf);
+        txbuf = txbuf == txbufs[0] ? txbufs[1] : txbufs[0];
+    }
+    chSysUnlock();
+#elif defined(WS2812_SPI_SYNC)
+    spiSend(&WS2812_SPI, TXBUF_SIZE, txbuf);
+#elif !defined(WS2812_SPI_USE_CIRCULAR_BUFFER)
+    frame_sending = true;
+    spiStartSend(&WS2812_SPI, TXBUF_SIZE, txbuf);
 #endif
 }
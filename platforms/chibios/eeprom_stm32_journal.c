@@ -0,0 +1,576 @@
+/* Copyright 2022 QMK
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdbool.h>
+#include <string.h>
+#include "timer.h"
+#include "eeprom_driver.h"
+#include "eeprom_stm32_journal.h"
+#include "flash_stm32.h"
+
+/*
+ * Journaled EEPROM emulation, spread over FEE_PAGE_COUNT flash pages used as a ring.
+ *
+ * === PAGE LAYOUT ===
+ *
+ * ┌ Magic ┬ Seq lo ┬ Seq hi ┬ Flags ┬ Record ┬ Record ┬ ... ┬ FFFF ... ┐
+ * └───────┴────────┴────────┴───────┴────────┴────────┴─────┴──────────┘
+ *
+ * Pages are taken into use in ring order and numbered with a sequence number higher than
+ * any other page in flash, so the live chain is the run of pages whose sequence numbers
+ * keep increasing, and stale pages ahead of it always break that run. Flags are 0x0000 on the first page of a snapshot. The magic
+ * is programmed last, so a page with a torn header is simply not in use.
+ *
+ * === RECORD LAYOUT ===
+ *
+ * ┌ Type | Length ┬ Payload (Length bytes) ┬ CRC16 ┐
+ * └───────────────┴────────────────────────┴───────┘
+ *
+ * A DATA record is one committed transaction. Its payload is a list of segments,
+ * each an address, a byte count and that many bytes of data padded to a halfword.
+ * An END record closes a snapshot. The CRC covers the type, length and payload and is
+ * programmed last, so a record torn by a power loss fails the check and is skipped with
+ * the rest of its page; the whole transaction is then lost, never half of it.
+ *
+ * A snapshot is the full contents of the emulated EEPROM written as DATA records into
+ * fresh pages, followed by an END record. The pages from the start of the newest
+ * complete snapshot up to the newest page form the live chain; everything else is free.
+ *
+ * === GENERAL ALGORITHM ===
+ *
+ * During initialization:
+ * The page headers are read to find the newest page and the newest snapshot that was
+ * completed. Only the records from that snapshot onwards are replayed into the RAM cache.
+ *
+ * During reads:
+ * EEPROM contents are given back directly from the cache in memory.
+ *
+ * During writes:
+ * The cache is updated and the changed range remembered. On commit, either straight
+ * away or at eeprom_transaction_commit(), the ranges are appended as one DATA record.
+ * When the newest page is full, the next free page in the ring is erased and used,
+ * unless that would leave too few free pages for a snapshot, in which case a snapshot
+ * is written instead and the old chain becomes free. Pages are therefore erased one at
+ * a time, in turn, and the live data never depends on a page that is being erased.
+ */
+
+/* The journal needs more pages than the layout eeprom_stm32.c uses by default */
+#ifndef FEE_PAGE_COUNT
+#    define FEE_PAGE_COUNT 8
+#endif
+
+#include "eeprom_stm32_defs.h"
+#if !defined(FEE_PAGE_SIZE) || !defined(FEE_PAGE_COUNT) || !defined(FEE_MCU_FLASH_SIZE) || !defined(FEE_PAGE_BASE_ADDRESS)
+#    error "not implemented."
+#endif
+
+#if FEE_PAGE_COUNT < 3
+#    error "journaled eeprom: FEE_PAGE_COUNT must be at least 3"
+#endif
+
+/* Size of emulated eeprom */
+#ifndef FEE_DENSITY_BYTES
+#    define FEE_DENSITY_BYTES (FEE_PAGE_SIZE / 2)
+#endif
+#if ((FEE_DENSITY_BYTES) % 2) == 1
+#    error "journaled eeprom: FEE_DENSITY_BYTES must be even"
+#endif
+#if FEE_DENSITY_BYTES > 0x10000
+#    error "journaled eeprom: FEE_DENSITY_BYTES must be 65536 or less"
+#endif
+
+#if defined(DYNAMIC_KEYMAP_EEPROM_MAX_ADDR) && (DYNAMIC_KEYMAP_EEPROM_MAX_ADDR >= FEE_DENSITY_BYTES)
+#    error "journaled eeprom: DYNAMIC_KEYMAP_EEPROM_MAX_ADDR is greater than the FEE_DENSITY_BYTES available"
+#endif
+
+/* Largest payload a single transaction can carry before it falls back to a snapshot */
+#ifndef FEE_JOURNAL_TRANSACTION_BYTES
+#    define FEE_JOURNAL_TRANSACTION_BYTES 128
+#endif
+#ifndef FEE_JOURNAL_TRANSACTION_SEGMENTS
+#    define FEE_JOURNAL_TRANSACTION_SEGMENTS 8
+#endif
+
+#define JOURNAL_MAGIC 0x4A52
+#define JOURNAL_EMPTY_WORD ((uint16_t)0xFFFF)
+#define JOURNAL_FLAG_SNAPSHOT 0x0000
+
+#define JOURNAL_RECORD_DATA 0x1000
+#define JOURNAL_RECORD_END 0x2000
+#define JOURNAL_RECORD_TYPE_MASK 0xF000
+#define JOURNAL_RECORD_LENGTH_MASK 0x0FFF
+
+#define JOURNAL_PAGE_HEADER_BYTES 8
+#define JOURNAL_PAGE_DATA_BYTES (FEE_PAGE_SIZE - JOURNAL_PAGE_HEADER_BYTES)
+#define JOURNAL_RECORD_OVERHEAD 4
+#define JOURNAL_SEGMENT_OVERHEAD 4
+
+#define JOURNAL_SNAPSHOT_CHUNK 64
+#define JOURNAL_SNAPSHOT_RECORD_BYTES (JOURNAL_RECORD_OVERHEAD + JOURNAL_SEGMENT_OVERHEAD + JOURNAL_SNAPSHOT_CHUNK)
+#define JOURNAL_SNAPSHOT_RECORDS_PER_PAGE (JOURNAL_PAGE_DATA_BYTES / JOURNAL_SNAPSHOT_RECORD_BYTES)
+#define JOURNAL_SNAPSHOT_CHUNKS ((FEE_DENSITY_BYTES + JOURNAL_SNAPSHOT_CHUNK - 1) / JOURNAL_SNAPSHOT_CHUNK)
+/* Worst case, with no chunk left out for being blank; the END record is counted as one more chunk */
+#define JOURNAL_SNAPSHOT_PAGES ((JOURNAL_SNAPSHOT_CHUNKS + JOURNAL_SNAPSHOT_RECORDS_PER_PAGE) / JOURNAL_SNAPSHOT_RECORDS_PER_PAGE)
+
+#if JOURNAL_SNAPSHOT_RECORDS_PER_PAGE < 1
+#    error "journaled eeprom: FEE_PAGE_SIZE is too small"
+#endif
+#if (JOURNAL_SNAPSHOT_PAGES * 2 + 1) > FEE_PAGE_COUNT
+#    error "journaled eeprom: FEE_DENSITY_BYTES is too large, two snapshots and a log page must fit in FEE_PAGE_COUNT pages"
+#endif
+#if (FEE_JOURNAL_TRANSACTION_BYTES + JOURNAL_RECORD_OVERHEAD + JOURNAL_SEGMENT_OVERHEAD * FEE_JOURNAL_TRANSACTION_SEGMENTS) > JOURNAL_PAGE_DATA_BYTES
+#    error "journaled eeprom: FEE_JOURNAL_TRANSACTION_BYTES does not fit in a page"
+#endif
+
+#define JOURNAL_PAGE_ADDRESS(page) (FEE_PAGE_BASE_ADDRESS + (uintptr_t)(page)*FEE_PAGE_SIZE)
+#define JOURNAL_NEXT_PAGE(page) (((page) + 1) % FEE_PAGE_COUNT)
+
+/* In-memory contents of emulated eeprom */
+static uint16_t WordBuf[FEE_DENSITY_BYTES / 2];
+static uint8_t *DataBuf = (uint8_t *)WordBuf;
+
+/* The live chain, and where the next record goes */
+static uint8_t   chain_start;
+static uint8_t   chain_length;
+static uint8_t   head_page;
+static uint32_t  head_seq;
+static uintptr_t write_addr;
+
+typedef struct {
+    uint16_t address;
+    uint16_t length;
+} journal_segment_t;
+
+/* Ranges changed since the last commit */
+static journal_segment_t pending[FEE_JOURNAL_TRANSACTION_SEGMENTS];
+static uint8_t           pending_count;
+static uint16_t          pending_bytes;
+static bool              pending_overflow;
+static uint8_t           transaction_depth;
+/* Set when a commit failed, so the cache holds changes flash has not seen */
+static bool snapshot_needed;
+
+static eeprom_journal_stats_t journal_stats;
+static uint32_t               page_erases[FEE_PAGE_COUNT];
+
+static uint16_t crc16_update(uint16_t crc, uint16_t data) {
+    for (uint8_t i = 0; i < 16; i++) {
+        bool bit = ((crc >> 15) ^ (data >> 15)) & 1;
+        crc <<= 1;
+        data <<= 1;
+        if (bit) crc ^= 0x1021;
+    }
+    return crc;
+}
+
+static inline uint16_t flash_read(uintptr_t address) { return *(uint16_t *)address; }
+
+static bool flash_program(uintptr_t address, uint16_t value) {
+    journal_stats.halfwords_programmed++;
+    return FLASH_ProgramHalfWord(address, value) == FLASH_COMPLETE;
+}
+
+static bool page_is_blank(uint8_t page) {
+    for (uintptr_t address = JOURNAL_PAGE_ADDRESS(page); address < JOURNAL_PAGE_ADDRESS(page) + FEE_PAGE_SIZE; address += 2) {
+        if (flash_read(address) != JOURNAL_EMPTY_WORD) return false;
+    }
+    return true;
+}
+
+static bool page_erase(uint8_t page) {
+    page_erases[page]++;
+    journal_stats.page_erases++;
+    return FLASH_ErasePage(JOURNAL_PAGE_ADDRESS(page)) == FLASH_COMPLETE;
+}
+
+static bool page_header(uint8_t page, uint32_t *seq, bool *snapshot) {
+    uintptr_t base = JOURNAL_PAGE_ADDRESS(page);
+    if (flash_read(base) != JOURNAL_MAGIC) return false;
+    *seq      = flash_read(base + 2) | ((uint32_t)flash_read(base + 4) << 16);
+    *snapshot = flash_read(base + 6) == JOURNAL_FLAG_SNAPSHOT;
+    return *seq != 0;
+}
+
+/* Takes the page after the head into use. Never called for a page in the live chain. */
+static bool page_start(bool snapshot) {
+    uint8_t   page = chain_length ? JOURNAL_NEXT_PAGE(head_page) : head_page;
+    uintptr_t base = JOURNAL_PAGE_ADDRESS(page);
+
+    if (!page_is_blank(page) && !page_erase(page)) return false;
+
+    uint32_t seq = head_seq + 1;
+    if (!flash_program(base + 2, seq & 0xFFFF)) return false;
+    if (!flash_program(base + 4, seq >> 16)) return false;
+    if (snapshot && !flash_program(base + 6, JOURNAL_FLAG_SNAPSHOT)) return false;
+    if (!flash_program(base, JOURNAL_MAGIC)) return false;
+
+    head_page  = page;
+    head_seq   = seq;
+    write_addr = base + JOURNAL_PAGE_HEADER_BYTES;
+    chain_length++;
+    return true;
+}
+
+static uint16_t page_space(void) { return JOURNAL_PAGE_ADDRESS(head_page) + FEE_PAGE_SIZE - write_addr; }
+
+static uint16_t segments_size(const journal_segment_t *segments, uint8_t count) {
+    uint16_t size = 0;
+    for (uint8_t i = 0; i < count; i++) {
+        size += JOURNAL_SEGMENT_OVERHEAD + ((segments[i].length + 1) & ~1);
+    }
+    return size;
+}
+
+/* Appends a record at write_addr, which must have room for it */
+static bool record_write(uint16_t type, const journal_segment_t *segments, uint8_t count) {
+    uint16_t  length  = segments_size(segments, count);
+    uint16_t  header  = type | length;
+    uint16_t  crc     = crc16_update(0xFFFF, header);
+    uintptr_t address = write_addr;
+
+    // Wherever this stops, the next record starts after it
+    write_addr += JOURNAL_RECORD_OVERHEAD + length;
+
+    if (!flash_program(address, header)) return false;
+    address += 2;
+    for (uint8_t i = 0; i < count; i++) {
+        uint16_t words[2] = {segments[i].address, segments[i].length};
+        for (uint8_t j = 0; j < 2; j++) {
+            crc = crc16_update(crc, words[j]);
+            if (!flash_program(address, words[j])) return false;
+            address += 2;
+        }
+        for (uint16_t offset = 0; offset < segments[i].length; offset += 2) {
+            uint16_t value = DataBuf[segments[i].address + offset];
+            if (offset + 1 < segments[i].length) {
+                value |= DataBuf[segments[i].address + offset + 1] << 8;
+            }
+            crc = crc16_update(crc, value);
+            // Erased flash already reads 0xFFFF, so those halfwords need no programming
+            if (value != JOURNAL_EMPTY_WORD && !flash_program(address, value)) return false;
+            address += 2;
+        }
+    }
+    return flash_program(address, crc);
+}
+
+/* Writes the whole cache into fresh pages. The old chain stays intact until the END record is down. */
+static bool snapshot_write_pages(void) {
+    if (!page_start(true)) return false;
+    uint8_t start = head_page;
+
+    for (uint16_t address = 0; address < FEE_DENSITY_BYTES; address += JOURNAL_SNAPSHOT_CHUNK) {
+        journal_segment_t chunk = {.address = address, .length = FEE_DENSITY_BYTES - address};
+        if (chunk.length > JOURNAL_SNAPSHOT_CHUNK) chunk.length = JOURNAL_SNAPSHOT_CHUNK;
+
+        bool blank = true;
+        for (uint16_t i = 0; i < chunk.length && blank; i++) {
+            blank = !DataBuf[address + i];
+        }
+        if (blank) continue;
+
+        if (page_space() < JOURNAL_RECORD_OVERHEAD + segments_size(&chunk, 1) && !page_start(false)) return false;
+        if (!record_write(JOURNAL_RECORD_DATA, &chunk, 1)) return false;
+    }
+    if (page_space() < JOURNAL_RECORD_OVERHEAD && !page_start(false)) return false;
+    if (!record_write(JOURNAL_RECORD_END, NULL, 0)) return false;
+
+    chain_start = start;
+    return true;
+}
+
+static bool snapshot_write(void) {
+    uint8_t old_head   = head_page;
+    uint8_t old_length = chain_length;
+
+    if (!snapshot_write_pages()) {
+        /* The old chain is untouched; hand the pages of the failed snapshot back */
+        head_page    = old_head;
+        chain_length = old_length;
+        return false;
+    }
+    chain_length -= old_length;
+    journal_stats.snapshots++;
+    return true;
+}
+
+/* Parses the records of one page into the cache. Returns where the page's records end;
+ * a torn record ends the page early, and *torn is set.
+ */
+static uintptr_t page_replay(uint8_t page, bool *snapshot_done, bool *torn) {
+    uintptr_t address = JOURNAL_PAGE_ADDRESS(page) + JOURNAL_PAGE_HEADER_BYTES;
+    uintptr_t end     = JOURNAL_PAGE_ADDRESS(page) + FEE_PAGE_SIZE;
+
+    *torn = false;
+    while (address + JOURNAL_RECORD_OVERHEAD <= end) {
+        uint16_t header = flash_read(address);
+        if (header == JOURNAL_EMPTY_WORD) break;
+
+        uint16_t type   = header & JOURNAL_RECORD_TYPE_MASK;
+        uint16_t length = header & JOURNAL_RECORD_LENGTH_MASK;
+        if ((type != JOURNAL_RECORD_DATA && type != JOURNAL_RECORD_END) || (length & 1) || address + JOURNAL_RECORD_OVERHEAD + length > end) {
+            *torn = true;
+            return end;
+        }
+
+        uint16_t crc = crc16_update(0xFFFF, header);
+        for (uint16_t offset = 0; offset < length; offset += 2) {
+            crc = crc16_update(crc, flash_read(address + 2 + offset));
+        }
+        if (crc != flash_read(address + 2 + length)) {
+            *torn = true;
+            return end;
+        }
+
+        // Only apply the record once the whole of it has been checked
+        uintptr_t segment = address + 2;
+        while (segment < address + 2 + length) {
+            uint16_t seg_address = flash_read(segment);
+            uint16_t seg_length  = flash_read(segment + 2);
+            segment += JOURNAL_SEGMENT_OVERHEAD;
+            for (uint16_t i = 0; i < seg_length; i++) {
+                uint16_t value = flash_read(segment + (i & ~1));
+                if ((uint32_t)seg_address + i < FEE_DENSITY_BYTES) {
+                    DataBuf[seg_address + i] = (i & 1) ? value >> 8 : value;
+                }
+            }
+            segment += (seg_length + 1) & ~1;
+        }
+        if (type == JOURNAL_RECORD_END) {
+            *snapshot_done = true;
+        }
+        journal_stats.records_replayed++;
+        address += JOURNAL_RECORD_OVERHEAD + length;
+    }
+    return address;
+}
+
+/* Starts over with blank flash and an empty snapshot */
+static void journal_format(void) {
+    FLASH_Unlock();
+    for (uint8_t page = 0; page < FEE_PAGE_COUNT; page++) {
+        if (!page_is_blank(page)) page_erase(page);
+    }
+    memset(WordBuf, 0, sizeof(WordBuf));
+    chain_start  = 0;
+    chain_length = 0;
+    head_page    = 0;
+    head_seq     = 0;
+    snapshot_write();
+    FLASH_Lock();
+}
+
+/* Replays the chain that starts at `start`, stopping before `stop_seq`. Returns false if its snapshot never completed. */
+static bool journal_replay(uint8_t start, uint32_t stop_seq) {
+    bool      snapshot_done = false;
+    bool      torn          = false;
+    uint8_t   page          = start;
+    uint32_t  last_seq      = 0;
+    uintptr_t end           = 0;
+    uint32_t  seq;
+    bool      snapshot;
+
+    memset(WordBuf, 0, sizeof(WordBuf));
+    journal_stats.records_replayed = 0;
+    chain_length                   = 0;
+    while (chain_length < FEE_PAGE_COUNT && page_header(page, &seq, &snapshot) && seq > last_seq && seq < stop_seq) {
+        end       = page_replay(page, &snapshot_done, &torn);
+        head_page = page;
+        last_seq  = seq;
+        chain_length++;
+        page = JOURNAL_NEXT_PAGE(page);
+        if (!snapshot_done && torn) break;
+    }
+    if (!snapshot_done) return false;
+
+    chain_start = start;
+    write_addr  = end;
+    return true;
+}
+
+uint16_t EEPROM_Journal_Init(void) {
+    uint32_t start_time = timer_read32();
+    uint32_t seqs[FEE_PAGE_COUNT];
+    bool     starts[FEE_PAGE_COUNT];
+    uint32_t newest = 0;
+
+    pending_count     = 0;
+    pending_bytes     = 0;
+    pending_overflow  = false;
+    transaction_depth = 0;
+    snapshot_needed   = false;
+
+    for (uint8_t page = 0; page < FEE_PAGE_COUNT; page++) {
+        if (!page_header(page, &seqs[page], &starts[page])) {
+            seqs[page] = 0;
+        }
+        if (seqs[page] > newest) newest = seqs[page];
+    }
+
+    /* Try snapshots from the newest down; pages of a snapshot that never completed are left out of the chain */
+    uint32_t stop_seq = newest + 1;
+    bool     loaded   = false;
+    while (!loaded) {
+        uint8_t  best     = FEE_PAGE_COUNT;
+        uint32_t best_seq = 0;
+        for (uint8_t page = 0; page < FEE_PAGE_COUNT; page++) {
+            if (starts[page] && seqs[page] && seqs[page] < stop_seq && seqs[page] > best_seq) {
+                best     = page;
+                best_seq = seqs[page];
+            }
+        }
+        if (best == FEE_PAGE_COUNT) break;
+        loaded = journal_replay(best, stop_seq);
+        if (!loaded) stop_seq = best_seq;
+    }
+
+    if (!loaded) {
+        journal_format();
+    } else {
+        /* New pages must outnumber any stale page left over from a failed snapshot */
+        head_seq = newest;
+        /* A torn record may have left programmed halfwords past the last good one */
+        for (uintptr_t address = write_addr; address < JOURNAL_PAGE_ADDRESS(head_page) + FEE_PAGE_SIZE; address += 2) {
+            if (flash_read(address) != JOURNAL_EMPTY_WORD) {
+                write_addr = JOURNAL_PAGE_ADDRESS(head_page) + FEE_PAGE_SIZE;
+                break;
+            }
+        }
+    }
+
+    journal_stats.init_time = timer_elapsed32(start_time);
+    return FEE_DENSITY_BYTES;
+}
+
+void EEPROM_Journal_Erase(void) {
+    journal_format();
+    pending_count    = 0;
+    pending_bytes    = 0;
+    pending_overflow = false;
+    snapshot_needed  = false;
+}
+
+/* Writes the pending ranges as one record, or a snapshot if they do not fit */
+static void journal_commit(void) {
+    if (!pending_count && !pending_overflow && !snapshot_needed) return;
+
+    uint32_t start_time = timer_read32();
+    uint16_t size       = JOURNAL_RECORD_OVERHEAD + segments_size(pending, pending_count);
+    uint8_t  free_pages = FEE_PAGE_COUNT - chain_length;
+    bool     ok;
+
+    FLASH_Unlock();
+    if (pending_overflow || snapshot_needed) {
+        ok = snapshot_write();
+    } else if (size <= page_space()) {
+        ok = record_write(JOURNAL_RECORD_DATA, pending, pending_count);
+    } else if (free_pages > JOURNAL_SNAPSHOT_PAGES) {
+        ok = page_start(false) && record_write(JOURNAL_RECORD_DATA, pending, pending_count);
+    } else {
+        ok = snapshot_write();
+    }
+    FLASH_Lock();
+
+    if (!ok) {
+        journal_stats.failed_commits++;
+        // Whatever made it to flash is unusable; carry on from a fresh page, with a full snapshot
+        write_addr      = JOURNAL_PAGE_ADDRESS(head_page) + FEE_PAGE_SIZE;
+        snapshot_needed = true;
+    } else {
+        snapshot_needed = false;
+    }
+    pending_count    = 0;
+    pending_bytes    = 0;
+    pending_overflow = false;
+    journal_stats.commits++;
+
+    uint32_t elapsed               = timer_elapsed32(start_time);
+    journal_stats.last_commit_time = elapsed;
+    if (elapsed > journal_stats.max_commit_time) journal_stats.max_commit_time = elapsed;
+}
+
+static void pending_add(uint16_t address, uint16_t length) {
+    for (uint8_t i = 0; i < pending_count; i++) {
+        journal_segment_t *segment = &pending[i];
+        // Merge with a range it overlaps or touches
+        if (address <= segment->address + segment->length && segment->address <= address + length) {
+            uint16_t start = address < segment->address ? address : segment->address;
+            uint16_t end   = address + length > segment->address + segment->length ? address + length : segment->address + segment->length;
+            pending_bytes += (end - start) - segment->length;
+            segment->address = start;
+            segment->length  = end - start;
+            if (pending_bytes > FEE_JOURNAL_TRANSACTION_BYTES) pending_overflow = true;
+            return;
+        }
+    }
+    if (pending_count == FEE_JOURNAL_TRANSACTION_SEGMENTS || pending_bytes + length > FEE_JOURNAL_TRANSACTION_BYTES) {
+        pending_overflow = true;
+        return;
+    }
+    pending[pending_count++] = (journal_segment_t){.address = address, .length = length};
+    pending_bytes += length;
+}
+
+void eeprom_transaction_begin(void) { transaction_depth++; }
+
+void eeprom_transaction_commit(void) {
+    if (transaction_depth && --transaction_depth) return;
+    journal_commit();
+}
+
+eeprom_journal_stats_t eeprom_journal_get_stats(void) { return journal_stats; }
+
+uint32_t eeprom_journal_page_erases(uint8_t page) { return page < FEE_PAGE_COUNT ? page_erases[page] : 0; }
+
+/*****************************************************************************
+ *  Bind to eeprom_driver.c
+ *******************************************************************************/
+void eeprom_driver_init(void) { EEPROM_Journal_Init(); }
+
+void eeprom_driver_erase(void) { EEPROM_Journal_Erase(); }
+
+void eeprom_driver_read_block(void *buf, const void *addr, size_t len) {
+    uintptr_t address = (uintptr_t)addr;
+    uint8_t * dest    = (uint8_t *)buf;
+    for (size_t i = 0; i < len; i++, address++) {
+        dest[i] = address < FEE_DENSITY_BYTES ? DataBuf[address] : 0xFF;
+    }
+}
+
+void eeprom_driver_write_block(const void *buf, void *addr, size_t len) {
+    uintptr_t      address = (uintptr_t)addr;
+    const uint8_t *src     = (const uint8_t *)buf;
+
+    if (address >= FEE_DENSITY_BYTES) return;
+    if (address + len > FEE_DENSITY_BYTES) len = FEE_DENSITY_BYTES - address;
+
+    /* Only the bytes that actually change go into the journal */
+    while (len && DataBuf[address] == *src) {
+        address++;
+        src++;
+        len--;
+    }
+    while (len && DataBuf[address + len - 1] == src[len - 1]) {
+        len--;
+    }
+    if (!len) return;
+
+    memcpy(&DataBuf[address], src, len);
+    pending_add(address, len);
+    if (!transaction_depth) {
+        journal_commit();
+    }
+}
@@ -0,0 +1,38 @@
+/* Copyright 2022 QMK
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+/* Counters since boot */
+typedef struct {
+    uint32_t commits;               // Transactions written, including those that became snapshots
+    uint32_t failed_commits;        // Commits that could not be programmed
+    uint32_t snapshots;             // Full snapshots written, including the one made when formatting
+    uint32_t page_erases;           // Flash pages erased, across all pages
+    uint32_t halfwords_programmed;  // Flash halfwords programmed
+    uint32_t records_replayed;      // Records read back at the last init
+    uint32_t init_time;             // Milliseconds spent by the last init
+    uint32_t last_commit_time;      // Milliseconds spent by the last commit
+    uint32_t max_commit_time;       // Milliseconds spent by the slowest commit
+} eeprom_journal_stats_t;
+
+uint16_t EEPROM_Journal_Init(void);
+void     EEPROM_Journal_Erase(void);
+
+eeprom_journal_stats_t eeprom_journal_get_stats(void);
+uint32_t               eeprom_journal_page_erases(uint8_t page);  // Number of times the given page has been erased since boot
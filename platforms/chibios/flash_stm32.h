@@ -26,6 +26,7 @@ extern "C" {
 
 #ifdef FLASH_STM32_MOCKED
 extern uint8_t FlashBuf[MOCK_FLASH_SIZE];
+extern int32_t FlashOperationsLeft;
 #endif
 
 typedef enum { FLASH_BUSY = 1, FLASH_ERROR_PG, FLASH_ERROR_WRP, FLASH_ERROR_OPT, FLASH_COMPLETE, FLASH_TIMEOUT, FLASH_BAD_ADDRESS } FLASH_Status;
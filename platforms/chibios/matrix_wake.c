@@ -0,0 +1,68 @@
+/* Copyright 2022 QMK
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <ch.h>
+#include <hal.h>
+
+#include "matrix_wake.h"
+
+#if !PAL_USE_CALLBACKS
+#    error "MATRIX_WAKE_ENABLE requires '#define PAL_USE_CALLBACKS TRUE' in halconf.h"
+#endif
+
+static BSEMAPHORE_DECL(matrix_wake_sem, true);
+
+static void matrix_wake_callback(void *arg) {
+    (void)arg;
+
+    chSysLockFromISR();
+    chBSemSignalI(&matrix_wake_sem);
+    chSysUnlockFromISR();
+}
+
+bool matrix_wake_wait(const pin_t pins[], uint8_t count, uint32_t timeout_ms) {
+    bool woken = false;
+
+    // Drop any edge left over from the last time the lines were armed
+    chBSemReset(&matrix_wake_sem, true);
+
+    for (uint8_t i = 0; i < count; i++) {
+        if (pins[i] != NO_PIN) {
+            palEnableLineEvent(pins[i], PAL_EVENT_MODE_BOTH_EDGES);
+            palSetLineCallback(pins[i], matrix_wake_callback, NULL);
+        }
+    }
+
+    // A key pressed before the lines were armed will not raise an edge, so check the levels once armed
+    for (uint8_t i = 0; i < count; i++) {
+        if (pins[i] != NO_PIN && !readPin(pins[i])) {
+            woken = true;
+            break;
+        }
+    }
+
+    if (!woken) {
+        woken = chBSemWaitTimeout(&matrix_wake_sem, TIME_MS2I(timeout_ms)) == MSG_OK;
+    }
+
+    for (uint8_t i = 0; i < count; i++) {
+        if (pins[i] != NO_PIN) {
+            palDisableLineEvent(pins[i]);
+        }
+    }
+
+    return woken;
+}
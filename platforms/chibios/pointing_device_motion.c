@@ -0,0 +1,47 @@
+/* Copyright 2022 QMK
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <ch.h>
+#include <hal.h>
+
+#include "pointing_device_motion.h"
+
+#if !PAL_USE_CALLBACKS
+#    error "POINTING_DEVICE_MOTION_IRQ_ENABLE requires '#define PAL_USE_CALLBACKS TRUE' in halconf.h"
+#endif
+
+static volatile bool motion_pending = false;
+
+static void pointing_device_motion_callback(void *arg) {
+    (void)arg;
+
+    chSysLockFromISR();
+    motion_pending = true;
+    chSysUnlockFromISR();
+}
+
+void pointing_device_motion_irq_init(pin_t pin) {
+    palEnableLineEvent(pin, PAL_EVENT_MODE_FALLING_EDGE);
+    palSetLineCallback(pin, pointing_device_motion_callback, NULL);
+}
+
+bool pointing_device_motion_irq_take(void) {
+    chSysLock();
+    bool pending   = motion_pending;
+    motion_pending = false;
+    chSysUnlock();
+    return pending;
+}
@@ -45,3 +45,29 @@ uint32_t timer_read32(void) {
 uint16_t timer_elapsed(uint16_t last) { return TIMER_DIFF_16(timer_read(), last); }
 
 uint32_t timer_elapsed32(uint32_t last) { return TIMER_DIFF_32(timer_read32(), last); }
+
+#ifdef TIMER_US_SUPPORTED
+uint32_t timer_read_us(void) {
+    // The counters wrap at other points than 2^32 microseconds, so add up their progress instead; reads more than
+    // one counter period apart lose whole periods, which only matters for intervals far longer than this is for
+#    ifdef TIMER_US_REALTIME_COUNTER
+    static rtcnt_t  last_count = 0;
+    static uint32_t rest = 0, us = 0;
+    rtcnt_t         count = chSysGetRealtimeCounterX();
+
+    rest += (rtcnt_t)(count - last_count);
+    us += rest / (STM32_HCLK / 1000000);
+    rest %= STM32_HCLK / 1000000;
+#    else
+    static systime_t last_count = 0;
+    static uint32_t  us         = 0;
+    systime_t        count      = chVTGetSystemTimeX();
+
+    us += (uint32_t)chTimeDiffX(last_count, count) * (1000000 / CH_CFG_ST_FREQUENCY);
+#    endif
+    last_count = count;
+    return us;
+}
+
+uint32_t timer_elapsed_us(uint32_t last) { return TIMER_DIFF_32(timer_read_us(), last); }
+#endif
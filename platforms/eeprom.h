@@ -19,3 +19,11 @@ void     eeprom_update_word(uint16_t *__p, uint16_t __value);
 void     eeprom_update_dword(uint32_t *__p, uint32_t __value);
 void     eeprom_update_block(const void *__src, void *__dst, size_t __n);
 #endif
+
+#ifdef EEPROM_JOURNAL
+void eeprom_transaction_begin(void);
+void eeprom_transaction_commit(void);
+#else
+#    define eeprom_transaction_begin()
+#    define eeprom_transaction_commit()
+#endif
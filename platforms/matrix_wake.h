@@ -0,0 +1,28 @@
+/* Copyright 2022 QMK
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "gpio.h"
+
+/* Park the calling thread until one of the given input pins sees an edge,
+ * or timeout_ms elapses. The pins are expected to idle high with the
+ * matrix outputs already driven; NO_PIN entries are skipped.
+ * Returns true if woken by a pin change.
+ */
+bool matrix_wake_wait(const pin_t pins[], uint8_t count, uint32_t timeout_ms);
@@ -0,0 +1,29 @@
+/* Copyright 2022 QMK
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include "gpio.h"
+
+/* Arm an edge interrupt on the pointing sensor's active-low motion pin, so
+ * motion is latched even if the pin is released again before the main loop
+ * gets to look at it.
+ */
+void pointing_device_motion_irq_init(pin_t pin);
+
+/* Returns true if the motion pin has fired since the last call, and clears it. */
+bool pointing_device_motion_irq_take(void);
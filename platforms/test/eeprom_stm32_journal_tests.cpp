@@ -0,0 +1,181 @@
+/* Copyright 2022 QMK
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "flash_stm32.h"
+#include "eeprom_stm32_journal.h"
+#include "eeprom_driver.h"
+}
+
+/* Mock Flash Parameters:
+ *
+ * flash size: 4096
+ * page size: 512
+ * journal pages: 8
+ * Simulated EEPROM size: 256
+ *
+ * FlashBuf Layout:
+ * [Page 0 | Page 1 | ... | Page 7 ]
+ * [0......|512.....| ... |3584...4095]
+ */
+
+#define EEPROM_SIZE FEE_DENSITY_BYTES
+
+class EepromStm32JournalTest : public testing::Test {
+   protected:
+    void SetUp() override {
+        FlashOperationsLeft = -1;
+        memset(FlashBuf, 0, sizeof(FlashBuf));
+        eeprom_driver_init();
+    }
+
+    /* Commits the same value to two fields far apart, as one transaction */
+    void commit_pair(uint32_t value) {
+        eeprom_transaction_begin();
+        eeprom_update_dword((uint32_t*)0, value);
+        eeprom_update_dword((uint32_t*)(EEPROM_SIZE - 4), value);
+        eeprom_transaction_commit();
+    }
+
+    void expect_pair(uint32_t value) {
+        EXPECT_EQ(eeprom_read_dword((uint32_t*)0), value);
+        EXPECT_EQ(eeprom_read_dword((uint32_t*)(EEPROM_SIZE - 4)), value);
+    }
+};
+
+TEST_F(EepromStm32JournalTest, TestErase) {
+    eeprom_write_byte((uint8_t*)0, 0x42);
+    eeprom_driver_erase();
+    EXPECT_EQ(eeprom_read_byte((uint8_t*)0), 0);
+    eeprom_driver_init();
+    EXPECT_EQ(eeprom_read_byte((uint8_t*)0), 0);
+}
+
+TEST_F(EepromStm32JournalTest, TestReadGarbage) {
+    uint8_t garbage = 0x3c;
+    for (int i = 0; i < MOCK_FLASH_SIZE; ++i) {
+        garbage ^= 0xa3;
+        garbage += i;
+        FlashBuf[i] = garbage;
+    }
+    eeprom_driver_init();  // Just verify we don't crash
+    eeprom_write_byte((uint8_t*)3, 0x42);
+    eeprom_driver_init();
+    EXPECT_EQ(eeprom_read_byte((uint8_t*)3), 0x42);
+}
+
+TEST_F(EepromStm32JournalTest, TestReadBadAddress) {
+    EXPECT_EQ(eeprom_read_byte((uint8_t*)EEPROM_SIZE), 0xFF);
+    EXPECT_EQ(eeprom_read_dword((uint32_t*)(EEPROM_SIZE - 3)), 0xFF000000);
+    eeprom_write_dword((uint32_t*)(EEPROM_SIZE - 2), 0x12345678);
+    EXPECT_EQ(eeprom_read_word((uint16_t*)(EEPROM_SIZE - 2)), 0x5678);
+}
+
+TEST_F(EepromStm32JournalTest, TestWriteSurvivesInit) {
+    eeprom_write_byte((uint8_t*)1, 0x01);
+    eeprom_write_word((uint16_t*)2, 0xbeef);
+    eeprom_write_dword((uint32_t*)(EEPROM_SIZE - 4), 0xdeadbeef);
+    eeprom_write_byte((uint8_t*)1, 0xff);
+    eeprom_driver_init();
+    EXPECT_EQ(eeprom_read_byte((uint8_t*)1), 0xff);
+    EXPECT_EQ(eeprom_read_word((uint16_t*)2), 0xbeef);
+    EXPECT_EQ(eeprom_read_dword((uint32_t*)(EEPROM_SIZE - 4)), 0xdeadbeef);
+}
+
+TEST_F(EepromStm32JournalTest, TestTransactionIsOneCommit) {
+    uint32_t commits = eeprom_journal_get_stats().commits;
+    eeprom_transaction_begin();
+    eeprom_transaction_begin();
+    eeprom_write_dword((uint32_t*)0, 0x11111111);
+    eeprom_transaction_commit();
+    eeprom_write_dword((uint32_t*)100, 0x22222222);
+    eeprom_transaction_commit();
+    EXPECT_EQ(eeprom_journal_get_stats().commits, commits + 1);
+    eeprom_driver_init();
+    EXPECT_EQ(eeprom_read_dword((uint32_t*)0), 0x11111111);
+    EXPECT_EQ(eeprom_read_dword((uint32_t*)100), 0x22222222);
+}
+
+TEST_F(EepromStm32JournalTest, TestUnchangedWriteIsNotCommitted) {
+    eeprom_write_dword((uint32_t*)8, 0x12345678);
+    uint32_t programmed = eeprom_journal_get_stats().halfwords_programmed;
+    eeprom_write_dword((uint32_t*)8, 0x12345678);
+    EXPECT_EQ(eeprom_journal_get_stats().halfwords_programmed, programmed);
+}
+
+TEST_F(EepromStm32JournalTest, TestLargeTransactionBecomesSnapshot) {
+    uint8_t data[EEPROM_SIZE];
+    for (int i = 0; i < EEPROM_SIZE; ++i) {
+        data[i] = i ^ 0x5a;
+    }
+    uint32_t snapshots = eeprom_journal_get_stats().snapshots;
+    eeprom_write_block(data, (void*)0, EEPROM_SIZE);
+    EXPECT_EQ(eeprom_journal_get_stats().snapshots, snapshots + 1);
+    eeprom_driver_init();
+    for (int i = 0; i < EEPROM_SIZE; ++i) {
+        EXPECT_EQ(eeprom_read_byte((uint8_t*)i), data[i]);
+    }
+}
+
+TEST_F(EepromStm32JournalTest, TestWearIsSpreadAcrossPages) {
+    for (uint32_t i = 1; i <= 5000; ++i) {
+        commit_pair(i);
+        eeprom_write_byte((uint8_t*)(16 + i % 64), i);
+    }
+    eeprom_driver_init();
+    expect_pair(5000);
+
+    uint32_t min_erases = UINT32_MAX, max_erases = 0;
+    for (uint8_t page = 0; page < FEE_PAGE_COUNT; ++page) {
+        uint32_t erases = eeprom_journal_page_erases(page);
+        if (erases < min_erases) min_erases = erases;
+        if (erases > max_erases) max_erases = erases;
+    }
+    EXPECT_GT(min_erases, 10u);
+    EXPECT_LE(max_erases - min_erases, 1u);
+}
+
+TEST_F(EepromStm32JournalTest, TestCommitIsAtomicOnPowerLoss) {
+    /* Cut power after every few flash operations, across enough commits to rotate pages */
+    uint32_t snapshots = 0;
+    for (int32_t cut = 0; cut < 3000; cut += 3) {
+        SetUp();
+        FlashOperationsLeft = cut;
+        snapshots -= eeprom_journal_get_stats().snapshots;
+
+        uint32_t committed = 0;
+        for (uint32_t i = 1; i <= 300; ++i) {
+            uint32_t failed = eeprom_journal_get_stats().failed_commits;
+            commit_pair(i);
+            if (eeprom_journal_get_stats().failed_commits != failed) break;
+            committed = i;
+        }
+
+        snapshots += eeprom_journal_get_stats().snapshots;
+
+        FlashOperationsLeft = -1;
+        eeprom_driver_init();
+        expect_pair(committed);
+
+        /* The journal carries on from whatever was recovered */
+        commit_pair(0xcafe0000 + cut);
+        eeprom_driver_init();
+        expect_pair(0xcafe0000 + cut);
+    }
+    EXPECT_GT(snapshots, 0u);
+}
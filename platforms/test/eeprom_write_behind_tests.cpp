@@ -0,0 +1,136 @@
+/* Copyright 2022 QMK
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <string.h>
+#include <vector>
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "eeprom_driver.h"
+#include "timer.h"
+
+void set_time(uint32_t t);
+void advance_time(uint32_t ms);
+}
+
+/* Built with EEPROM_WRITE_BEHIND_PAGE_SIZE=8, EEPROM_WRITE_BEHIND_PAGES=2 and EEPROM_WRITE_BEHIND_DELAY=100 */
+#define BACKEND_SIZE 64
+
+struct backend_write {
+    uintptr_t addr;
+    size_t    len;
+};
+
+static uint8_t                    backend[BACKEND_SIZE];
+static std::vector<backend_write> backend_writes;
+
+extern "C" void eeprom_driver_init(void) {}
+
+extern "C" void eeprom_driver_erase(void) { memset(backend, 0, sizeof(backend)); }
+
+extern "C" void eeprom_driver_read_block(void *buf, const void *addr, size_t len) { memcpy(buf, &backend[(uintptr_t)addr], len); }
+
+extern "C" void eeprom_driver_write_block(const void *buf, void *addr, size_t len) {
+    memcpy(&backend[(uintptr_t)addr], buf, len);
+    backend_writes.push_back({(uintptr_t)addr, len});
+}
+
+class EepromWriteBehind : public testing::Test {
+   protected:
+    void SetUp() override {
+        eeprom_write_behind_discard();
+        eeprom_driver_erase();
+        backend_writes.clear();
+        set_time(1000);
+    }
+
+    void idle_for(uint32_t ms) {
+        for (uint32_t i = 0; i < ms; i++) {
+            eeprom_write_behind_task();
+            advance_time(1);
+        }
+    }
+};
+
+TEST_F(EepromWriteBehind, WritesAreReadBackBeforeTheyReachTheDriver) {
+    eeprom_update_dword((uint32_t *)6, 0x12345678);
+    EXPECT_TRUE(backend_writes.empty());
+    EXPECT_EQ(eeprom_read_dword((const uint32_t *)6), 0x12345678u);
+    EXPECT_EQ(eeprom_read_byte((const uint8_t *)7), 0x56);
+    EXPECT_EQ(backend[6], 0);
+}
+
+TEST_F(EepromWriteBehind, RepeatedWritesAreCoalesced) {
+    for (uint8_t i = 0; i < 50; i++) {
+        eeprom_update_byte((uint8_t *)3, i);
+        eeprom_update_byte((uint8_t *)5, i + 1);
+        idle_for(10);
+    }
+    EXPECT_TRUE(backend_writes.empty());
+
+    idle_for(100);
+    ASSERT_EQ(backend_writes.size(), 1u);
+    EXPECT_EQ(backend_writes[0].addr, 3u);
+    EXPECT_EQ(backend_writes[0].len, 3u);
+    EXPECT_EQ(backend[3], 49);
+    EXPECT_EQ(backend[5], 50);
+}
+
+TEST_F(EepromWriteBehind, FlushesOnePagePerTask) {
+    uint8_t data[20];
+    for (uint8_t i = 0; i < sizeof(data); i++) {
+        data[i] = i + 1;
+    }
+    /* Spans three pages, so one of them has to be written out to make room. */
+    eeprom_update_block(data, (void *)2, sizeof(data));
+    ASSERT_EQ(backend_writes.size(), 1u);
+    EXPECT_EQ(backend_writes[0].addr, 2u);
+    EXPECT_EQ(backend_writes[0].len, 6u);
+
+    uint8_t readback[20];
+    eeprom_read_block(readback, (const void *)2, sizeof(readback));
+    EXPECT_EQ(memcmp(data, readback, sizeof(data)), 0);
+
+    idle_for(100);
+    EXPECT_EQ(backend_writes.size(), 1u);
+    eeprom_write_behind_task();
+    EXPECT_EQ(backend_writes.size(), 2u);
+    eeprom_write_behind_task();
+    EXPECT_EQ(backend_writes.size(), 3u);
+    eeprom_write_behind_task();
+    EXPECT_EQ(backend_writes.size(), 3u);
+    EXPECT_EQ(memcmp(data, &backend[2], sizeof(data)), 0);
+}
+
+TEST_F(EepromWriteBehind, FlushWritesEverythingAtOnce) {
+    eeprom_update_word((uint16_t *)0, 0xBEEF);
+    eeprom_update_word((uint16_t *)40, 0xCAFE);
+    eeprom_write_behind_flush();
+    EXPECT_EQ(backend_writes.size(), 2u);
+    EXPECT_EQ(backend[0], 0xEF);
+    EXPECT_EQ(backend[41], 0xCA);
+
+    idle_for(200);
+    EXPECT_EQ(backend_writes.size(), 2u);
+}
+
+TEST_F(EepromWriteBehind, DiscardDropsPendingWrites) {
+    eeprom_update_byte((uint8_t *)10, 0xAA);
+    eeprom_write_behind_discard();
+    idle_for(200);
+    EXPECT_TRUE(backend_writes.empty());
+    EXPECT_EQ(eeprom_read_byte((const uint8_t *)10), 0);
+}
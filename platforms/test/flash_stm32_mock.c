@@ -20,10 +20,21 @@
 
 uint8_t FlashBuf[MOCK_FLASH_SIZE] = {0};
 
+/* Erases and writes left before the flash stops taking them, as if power was lost. Negative for no limit. */
+int32_t FlashOperationsLeft = -1;
+
 static bool flash_locked = true;
 
+static bool flash_power_lost(void) {
+    if (FlashOperationsLeft < 0) return false;
+    if (FlashOperationsLeft == 0) return true;
+    FlashOperationsLeft--;
+    return false;
+}
+
 FLASH_Status FLASH_ErasePage(uint32_t Page_Address) {
     if (flash_locked) return FLASH_ERROR_WRP;
+    if (flash_power_lost()) return FLASH_ERROR_PG;
     Page_Address -= (uintptr_t)FlashBuf;
     Page_Address -= (Page_Address % FEE_PAGE_SIZE);
     if (Page_Address >= MOCK_FLASH_SIZE) return FLASH_BAD_ADDRESS;
@@ -35,6 +46,7 @@ FLASH_Status FLASH_ProgramHalfWord(uint32_t Address, uint16_t Data) {
     if (flash_locked) return FLASH_ERROR_WRP;
     Address -= (uintptr_t)FlashBuf;
     if (Address >= MOCK_FLASH_SIZE) return FLASH_BAD_ADDRESS;
+    if (flash_power_lost()) return FLASH_ERROR_PG;
     uint16_t oldData = *(uint16_t*)&FlashBuf[Address];
     if (oldData == 0xFFFF || Data == 0) {
         *(uint16_t*)&FlashBuf[Address] = Data;
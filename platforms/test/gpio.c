@@ -0,0 +1,78 @@
+/* Copyright 2022 QMK
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <string.h>
+#include "gpio.h"
+
+#define PIN_PORT(pin) ((pin) >> 4)
+#define PIN_BIT(pin) ((pin)&0xF)
+
+static uint16_t port_levels[TEST_GPIO_PORT_COUNT];
+static uint16_t port_outputs[TEST_GPIO_PORT_COUNT];
+static uint32_t pin_reads  = 0;
+static uint32_t port_reads = 0;
+
+void test_gpio_reset(void) {
+    memset(port_levels, 0xFF, sizeof(port_levels));
+    memset(port_outputs, 0, sizeof(port_outputs));
+    pin_reads  = 0;
+    port_reads = 0;
+}
+
+void test_gpio_set_port(uint8_t port, uint16_t levels) {
+    if (port < TEST_GPIO_PORT_COUNT) {
+        port_levels[port] = levels;
+    }
+}
+
+uint32_t test_gpio_pin_reads(void) { return pin_reads; }
+uint32_t test_gpio_port_reads(void) { return port_reads; }
+
+void test_gpio_set_mode(pin_t pin, bool output) {
+    if (PIN_PORT(pin) < TEST_GPIO_PORT_COUNT) {
+        if (output) {
+            port_outputs[PIN_PORT(pin)] |= (1 << PIN_BIT(pin));
+        } else {
+            port_outputs[PIN_PORT(pin)] &= ~(1 << PIN_BIT(pin));
+        }
+    }
+}
+
+void test_gpio_write_pin(pin_t pin, bool level) {
+    if (PIN_PORT(pin) < TEST_GPIO_PORT_COUNT && (port_outputs[PIN_PORT(pin)] & (1 << PIN_BIT(pin)))) {
+        if (level) {
+            port_levels[PIN_PORT(pin)] |= (1 << PIN_BIT(pin));
+        } else {
+            port_levels[PIN_PORT(pin)] &= ~(1 << PIN_BIT(pin));
+        }
+    }
+}
+
+bool test_gpio_read_pin(pin_t pin) {
+    pin_reads++;
+    if (PIN_PORT(pin) >= TEST_GPIO_PORT_COUNT) {
+        return true;
+    }
+    return port_levels[PIN_PORT(pin)] & (1 << PIN_BIT(pin));
+}
+
+uint16_t test_gpio_read_port(pin_t pin) {
+    port_reads++;
+    if (PIN_PORT(pin) >= TEST_GPIO_PORT_COUNT) {
+        return 0xFFFF;
+    }
+    return port_levels[PIN_PORT(pin)];
+}
@@ -0,0 +1,58 @@
+/* Copyright 2022 QMK
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "pin_defs.h"
+
+/* GPIO stand-in for host tests. Pins are encoded as (port << 4 | bit), so
+ * both per-pin and per-port access can be exercised. Only the input levels
+ * are modelled; tests set them with test_gpio_set_port().
+ */
+typedef uint8_t pin_t;
+
+#define TEST_GPIO_PORT_COUNT 8
+#define TEST_PIN(port, bit) ((pin_t)(((port) << 4) | (bit)))
+
+void     test_gpio_reset(void);
+void     test_gpio_set_port(uint8_t port, uint16_t levels);
+uint32_t test_gpio_pin_reads(void);
+uint32_t test_gpio_port_reads(void);
+
+void     test_gpio_set_mode(pin_t pin, bool output);
+void     test_gpio_write_pin(pin_t pin, bool level);
+bool     test_gpio_read_pin(pin_t pin);
+uint16_t test_gpio_read_port(pin_t pin);
+
+/* Operation of GPIO by pin. */
+
+#define setPinInput(pin) test_gpio_set_mode(pin, false)
+#define setPinInputHigh(pin) test_gpio_set_mode(pin, false)
+#define setPinInputLow(pin) test_gpio_set_mode(pin, false)
+#define setPinOutput(pin) test_gpio_set_mode(pin, true)
+
+#define writePinHigh(pin) test_gpio_write_pin(pin, true)
+#define writePinLow(pin) test_gpio_write_pin(pin, false)
+#define writePin(pin, level) test_gpio_write_pin(pin, level)
+
+#define readPin(pin) test_gpio_read_pin(pin)
+
+/* Operation of GPIO by port. */
+
+typedef uint16_t port_data_t;
+
+#define readPort(pin) test_gpio_read_port(pin)
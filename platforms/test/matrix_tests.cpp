@@ -0,0 +1,112 @@
+/* Copyright 2022 QMK
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "gtest/gtest.h"
+
+#include <chrono>
+#include <iostream>
+
+extern "C" {
+#include "gpio.h"
+#include "matrix.h"
+
+matrix_row_t raw_matrix[MATRIX_ROWS];
+matrix_row_t matrix[MATRIX_ROWS];
+
+void debounce_init(uint8_t num_rows) {}
+void debounce(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, bool changed) {}
+void matrix_init_quantum(void) {}
+void matrix_scan_quantum(void) {}
+void matrix_output_select_delay(void) {}
+void matrix_output_unselect_delay(uint8_t line, bool key_pressed) {}
+
+void matrix_read_cols_on_row(matrix_row_t current_matrix[], uint8_t current_row);
+}
+
+// Drive the column port levels so that exactly the columns in `pressed` read low
+static void press_columns(matrix_row_t pressed) {
+    uint16_t port1 = 0xFFFF & ~(pressed & 0x0FFF);
+    uint16_t port2 = 0xFFFF;
+    for (uint8_t col = 12; col < 16; col++) {
+        if (pressed & (1 << col)) {
+            port2 &= ~(1 << (15 - col));
+        }
+    }
+    test_gpio_set_port(1, port1);
+    test_gpio_set_port(2, port2);
+}
+
+class Matrix : public testing::Test {
+   protected:
+    void SetUp() override {
+        test_gpio_reset();
+        matrix_init();
+    }
+};
+
+TEST_F(Matrix, ReadsEachColumn) {
+    for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+        matrix_row_t current_matrix[MATRIX_ROWS] = {0};
+        press_columns(1 << col);
+        matrix_read_cols_on_row(current_matrix, 0);
+        EXPECT_EQ(current_matrix[0], (matrix_row_t)(1 << col)) << "column " << +col;
+    }
+}
+
+TEST_F(Matrix, ReadsColumnPatterns) {
+    const matrix_row_t patterns[] = {0x0000, 0xFFFF, 0xA5A5, 0x5A5A, 0xF00F, 0x0FF0, 0x8001, 0x1234};
+    for (auto pattern : patterns) {
+        matrix_row_t current_matrix[MATRIX_ROWS] = {0};
+        press_columns(pattern);
+        matrix_read_cols_on_row(current_matrix, 1);
+        EXPECT_EQ(current_matrix[1], pattern);
+    }
+}
+
+TEST_F(Matrix, GpioAccessesPerRow) {
+    matrix_row_t current_matrix[MATRIX_ROWS] = {0};
+    test_gpio_reset();
+    matrix_read_cols_on_row(current_matrix, 0);
+#ifdef MATRIX_COL_PORT_MAP
+    EXPECT_EQ(test_gpio_pin_reads(), 0);
+    EXPECT_EQ(test_gpio_port_reads(), 2);
+#else
+    EXPECT_EQ(test_gpio_pin_reads(), MATRIX_COLS);
+    EXPECT_EQ(test_gpio_port_reads(), 0);
+#endif
+}
+
+TEST_F(Matrix, Benchmark) {
+    const uint32_t        rows                        = 1000000;
+    matrix_row_t          current_matrix[MATRIX_ROWS] = {0};
+    volatile matrix_row_t sink                        = 0;
+    press_columns(0xA5A5);
+
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < rows; i++) {
+        matrix_read_cols_on_row(current_matrix, i & 1);
+        sink = sink + current_matrix[i & 1];
+    }
+    auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+
+#ifdef MATRIX_COL_PORT_MAP
+    const char *path = "port";
+#else
+    const char *path = "pin";
+#endif
+    std::cout << "[ BENCHMARK] " << path << " reads: " << (double)elapsed / rows << " ns per row" << std::endl;
+    RecordProperty("ns_per_row", (int)(elapsed / rows));
+}
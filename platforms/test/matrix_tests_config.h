@@ -0,0 +1,32 @@
+/* Copyright 2022 QMK
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#define MATRIX_ROWS 2
+#define MATRIX_COLS 16
+#define DIODE_DIRECTION COL2ROW
+
+// Twelve columns in order on port 1, the last four reversed on port 2
+#define MATRIX_ROW_PINS \
+    { TEST_PIN(0, 0), TEST_PIN(0, 1) }
+#define MATRIX_COL_PINS \
+    { TEST_PIN(1, 0), TEST_PIN(1, 1), TEST_PIN(1, 2), TEST_PIN(1, 3), TEST_PIN(1, 4), TEST_PIN(1, 5), TEST_PIN(1, 6), TEST_PIN(1, 7), TEST_PIN(1, 8), TEST_PIN(1, 9), TEST_PIN(1, 10), TEST_PIN(1, 11), TEST_PIN(2, 3), TEST_PIN(2, 2), TEST_PIN(2, 1), TEST_PIN(2, 0) }
+
+#ifdef MATRIX_TEST_PORT_READ
+#    define MATRIX_COL_PORT_MAP \
+        { {TEST_PIN(1, 0), 0x0FFF, 0}, {TEST_PIN(2, 0), 0x0008, -9}, {TEST_PIN(2, 0), 0x0004, -11}, {TEST_PIN(2, 0), 0x0002, -13}, {TEST_PIN(2, 0), 0x0001, -15} }
+#endif
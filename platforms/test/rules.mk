@@ -22,3 +22,46 @@ eeprom_stm32_SRC := \
 	$(PLATFORM_PATH)/chibios/eeprom_stm32.c
 eeprom_stm32_tiny_SRC := $(eeprom_stm32_SRC)
 eeprom_stm32_large_SRC := $(eeprom_stm32_SRC)
+
+MATRIX_COMMON_DEFS := -DNO_DEBUG -DIGNORE_ATOMIC_BLOCK
+MATRIX_COMMON_CONFIG := $(PLATFORM_PATH)/$(PLATFORM_KEY)/matrix_tests_config.h
+MATRIX_COMMON_SRC := \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/matrix_tests.cpp \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/gpio.c \
+	$(QUANTUM_PATH)/matrix.c
+
+matrix_pin_read_DEFS := $(MATRIX_COMMON_DEFS)
+matrix_pin_read_CONFIG := $(MATRIX_COMMON_CONFIG)
+matrix_pin_read_SRC := $(MATRIX_COMMON_SRC)
+
+matrix_port_read_DEFS := $(MATRIX_COMMON_DEFS) -DMATRIX_TEST_PORT_READ
+matrix_port_read_CONFIG := $(MATRIX_COMMON_CONFIG)
+matrix_port_read_SRC := $(MATRIX_COMMON_SRC)
+
+eeprom_write_behind_DEFS := \
+	-DEEPROM_WRITE_BEHIND_ENABLE \
+	-DEEPROM_WRITE_BEHIND_PAGE_SIZE=8 \
+	-DEEPROM_WRITE_BEHIND_PAGES=2 \
+	-DEEPROM_WRITE_BEHIND_DELAY=100
+eeprom_write_behind_INC := \
+	$(TOP_DIR)/drivers/eeprom
+eeprom_write_behind_SRC := \
+	$(TOP_DIR)/drivers/eeprom/eeprom_driver.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/eeprom_write_behind_tests.cpp \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c
+
+eeprom_stm32_journal_DEFS := $(eeprom_stm32_DEFS) \
+	-DEEPROM_JOURNAL \
+	-DFEE_MCU_FLASH_SIZE=4 \
+	-DMOCK_FLASH_SIZE=4096 \
+	-DFEE_PAGE_SIZE=512 \
+	-DFEE_PAGE_COUNT=8 \
+	-DFEE_DENSITY_BYTES=256
+eeprom_stm32_journal_INC := $(eeprom_stm32_INC) \
+	$(TOP_DIR)/drivers/eeprom
+eeprom_stm32_journal_SRC := \
+	$(TOP_DIR)/drivers/eeprom/eeprom_driver.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/eeprom_stm32_journal_tests.cpp \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/flash_stm32_mock.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c \
+	$(PLATFORM_PATH)/chibios/eeprom_stm32_journal.c
@@ -1 +1 @@
-TEST_LIST += eeprom_stm32_tiny eeprom_stm32_large
+TEST_LIST += eeprom_stm32_tiny eeprom_stm32_large eeprom_stm32_journal eeprom_write_behind matrix_pin_read matrix_port_read
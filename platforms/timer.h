@@ -43,6 +43,12 @@ uint32_t timer_read32(void);
 uint16_t timer_elapsed(uint16_t last);
 uint32_t timer_elapsed32(uint32_t last);
 
+#ifdef TIMER_US_SUPPORTED
+// Microseconds, for timing stretches of code shorter than the millisecond timers can tell apart; only on platforms that define TIMER_US_SUPPORTED
+uint32_t timer_read_us(void);
+uint32_t timer_elapsed_us(uint32_t last);
+#endif
+
 // Utility functions to check if a future time has expired & autmatically handle time wrapping if checked / reset frequently (half of max value)
 #define timer_expired(current, future) ((uint16_t)(current - future) < UINT16_MAX / 2)
 #define timer_expired32(current, future) ((uint32_t)(current - future) < UINT32_MAX / 2)
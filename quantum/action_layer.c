@@ -38,6 +38,7 @@ static void default_layer_state_set(layer_state_t state) {
     default_layer_state = state;
     default_layer_debug();
     debug("\n");
+    update_resolved_layers_cache();
 #ifdef STRICT_LAYER_RELEASE
     clear_keyboard_but_mods();  // To avoid stuck keys
 #else
@@ -104,6 +105,7 @@ void layer_state_set(layer_state_t state) {
     layer_state = state;
     layer_debug();
     dprintln();
+    update_resolved_layers_cache();
 #    ifdef STRICT_LAYER_RELEASE
     clear_keyboard_but_mods();  // To avoid stuck keys
 #    else
@@ -219,6 +221,57 @@ uint8_t read_source_layers_cache(keypos_t key) {
 }
 #endif
 
+#if !defined(NO_ACTION_LAYER) && defined(RESOLVED_LAYERS_CACHE)
+/** \brief resolved layers cache
+ *
+ * Holds the result of layer_switch_get_layer() for every key, valid for
+ * resolved_layers_state. Entries are only recomputed on demand once they
+ * have been marked stale by a layer change that can affect them.
+ */
+#    define RESOLVED_LAYER_STALE 0xFF
+
+static uint8_t       resolved_layers_cache[MATRIX_ROWS * MATRIX_COLS] = {0};
+static layer_state_t resolved_layers_state                             = 0;
+
+/** \brief update resolved layers cache
+ *
+ * Marks the keys whose resolved layer may differ under the current layer
+ * state. A key resolved to layer r is only affected if a layer above r was
+ * turned on, or r itself was turned off; changes below r are shadowed, and
+ * layers above r that turn off were transparent for that key anyway.
+ */
+void update_resolved_layers_cache(void) {
+    layer_state_t layers = layer_state | default_layer_state;
+    if (layers == resolved_layers_state) {
+        return;
+    }
+
+    layer_state_t enabled  = layers & ~resolved_layers_state;
+    layer_state_t disabled = resolved_layers_state & ~layers;
+    for (uint16_t key_number = 0; key_number < MATRIX_ROWS * MATRIX_COLS; key_number++) {
+        uint8_t layer = resolved_layers_cache[key_number];
+        if (layer == RESOLVED_LAYER_STALE) {
+            continue;
+        }
+        layer_state_t above = (layer_state_t) ~((((layer_state_t)2) << layer) - 1);
+        if ((enabled & above) || (disabled & ((layer_state_t)1 << layer))) {
+            resolved_layers_cache[key_number] = RESOLVED_LAYER_STALE;
+        }
+    }
+    resolved_layers_state = layers;
+}
+
+/** \brief clear resolved layers cache
+ *
+ * Marks every key stale. Must be called whenever keymap contents change.
+ */
+void clear_resolved_layers_cache(void) {
+    for (uint16_t key_number = 0; key_number < MATRIX_ROWS * MATRIX_COLS; key_number++) {
+        resolved_layers_cache[key_number] = RESOLVED_LAYER_STALE;
+    }
+}
+#endif
+
 /** \brief Store or get action (FIXME: Needs better summary)
  *
  * Make sure the action triggered when the key is released is the same
@@ -255,17 +308,38 @@ uint8_t layer_switch_get_layer(keypos_t key) {
     action_t action;
     action.code = ACTION_TRANSPARENT;
 
+#    ifdef RESOLVED_LAYERS_CACHE
+    // Catch up with layer_state written directly rather than through the setters
+    update_resolved_layers_cache();
+
+    // Keys outside the matrix are always resolved the slow way
+    const uint16_t key_number = (key.row < MATRIX_ROWS && key.col < MATRIX_COLS) ? key.col + (key.row * MATRIX_COLS) : MATRIX_ROWS * MATRIX_COLS;
+    if (key_number < MATRIX_ROWS * MATRIX_COLS && resolved_layers_cache[key_number] != RESOLVED_LAYER_STALE) {
+        return resolved_layers_cache[key_number];
+    }
+#    endif
+
     layer_state_t layers = layer_state | default_layer_state;
     /* check top layer first */
     for (int8_t i = MAX_LAYER - 1; i >= 0; i--) {
         if (layers & ((layer_state_t)1 << i)) {
             action = action_for_key(i, key);
             if (action.code != ACTION_TRANSPARENT) {
+#    ifdef RESOLVED_LAYERS_CACHE
+                if (key_number < MATRIX_ROWS * MATRIX_COLS) {
+                    resolved_layers_cache[key_number] = i;
+                }
+#    endif
                 return i;
             }
         }
     }
     /* fall back to layer 0 */
+#    ifdef RESOLVED_LAYERS_CACHE
+    if (key_number < MATRIX_ROWS * MATRIX_COLS) {
+        resolved_layers_cache[key_number] = 0;
+    }
+#    endif
     return 0;
 #else
     return get_highest_layer(default_layer_state);
@@ -140,6 +140,15 @@ uint8_t read_source_layers_cache(keypos_t key);
 #endif
 action_t store_or_get_action(bool pressed, keypos_t key);
 
+/* resolved layers cache */
+#if !defined(NO_ACTION_LAYER) && defined(RESOLVED_LAYERS_CACHE)
+void update_resolved_layers_cache(void);
+void clear_resolved_layers_cache(void);
+#else
+#    define update_resolved_layers_cache()
+#    define clear_resolved_layers_cache()
+#endif
+
 /* return the topmost non-transparent layer currently associated with key */
 uint8_t layer_switch_get_layer(keypos_t key);
 
@@ -15,6 +15,10 @@
  */
 #include "quantum.h"
 
+#ifdef EEPROM_WRITE_BEHIND_ENABLE
+#    include "eeprom_driver.h"
+#endif
+
 /** \brief Reset eeprom
  *
  * ...just incase someone wants to only change the eeprom behaviour
@@ -51,6 +55,10 @@ __attribute__((weak)) void bootmagic_lite(void) {
 
     if (matrix_get_row(row) & (1 << col)) {
         bootmagic_lite_reset_eeprom();
+#ifdef EEPROM_WRITE_BEHIND_ENABLE
+        // The reset is still in the write-behind cache, which the jump would lose
+        eeprom_write_behind_flush();
+#endif
 
         // Jump to bootloader.
         bootloader_jump();
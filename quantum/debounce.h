@@ -1,5 +1,12 @@
 #pragma once
 
+// Rows handled by one half's debounce state, which the per-key algorithms size statically from this
+#ifdef SPLIT_KEYBOARD
+#    define DEBOUNCE_NUM_ROWS (MATRIX_ROWS / 2)
+#else
+#    define DEBOUNCE_NUM_ROWS (MATRIX_ROWS)
+#endif
+
 // raw is the current key state
 // on entry cooked is the previous debounced state
 // on exit cooked is the current debounced state
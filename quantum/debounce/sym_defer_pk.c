@@ -22,13 +22,7 @@ When no state changes have occured for DEBOUNCE milliseconds, we push the state.
 #include "matrix.h"
 #include "timer.h"
 #include "quantum.h"
-#include <stdlib.h>
-
-#ifdef PROTOCOL_CHIBIOS
-#    if CH_CFG_USE_MEMCORE == FALSE
-#        error ChibiOS is configured without a memory allocator. Your keyboard may have set `#define CH_CFG_USE_MEMCORE FALSE`, which is incompatible with this debounce algorithm.
-#    endif
-#endif
+#include "debounce.h"
 
 #ifndef DEBOUNCE
 #    define DEBOUNCE 5
@@ -45,9 +39,9 @@ When no state changes have occured for DEBOUNCE milliseconds, we push the state.
 typedef uint8_t debounce_counter_t;
 
 #if DEBOUNCE > 0
-static debounce_counter_t *debounce_counters;
-static fast_timer_t        last_time;
-static bool                counters_need_update;
+static debounce_counter_t debounce_counters[DEBOUNCE_NUM_ROWS * MATRIX_COLS];
+static fast_timer_t       last_time;
+static bool               counters_need_update;
 
 #    define DEBOUNCE_ELAPSED 0
 
@@ -56,8 +50,7 @@ static void start_debounce_counters(matrix_row_t raw[], matrix_row_t cooked[], u
 
 // we use num_rows rather than MATRIX_ROWS to support split keyboards
 void debounce_init(uint8_t num_rows) {
-    debounce_counters = (debounce_counter_t *)malloc(num_rows * MATRIX_COLS * sizeof(debounce_counter_t));
-    int i             = 0;
+    int i = 0;
     for (uint8_t r = 0; r < num_rows; r++) {
         for (uint8_t c = 0; c < MATRIX_COLS; c++) {
             debounce_counters[i++] = DEBOUNCE_ELAPSED;
@@ -65,10 +58,7 @@ void debounce_init(uint8_t num_rows) {
     }
 }
 
-void debounce_free(void) {
-    free(debounce_counters);
-    debounce_counters = NULL;
-}
+void debounce_free(void) {}
 
 void debounce(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, bool changed) {
     bool updated_last = false;
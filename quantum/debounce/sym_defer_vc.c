@@ -0,0 +1,179 @@
+/*
+Copyright 2022 QMK
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 2 of the License, or
+(at your option) any later version.
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+Symmetric per-key algorithm with the same behaviour as sym_defer_pk, but the per-key
+counters are stored as vertical counters: bit n of every key's counter in a row is
+kept in one matrix_row_t, so a whole row is counted with a few bitwise operations.
+When no state changes have occured for DEBOUNCE milliseconds, we push the state.
+*/
+
+#include "matrix.h"
+#include "timer.h"
+#include "quantum.h"
+#include "debounce.h"
+#include <string.h>
+
+#ifndef DEBOUNCE
+#    define DEBOUNCE 5
+#endif
+
+// Maximum debounce: 255ms
+#if DEBOUNCE > UINT8_MAX
+#    undef DEBOUNCE
+#    define DEBOUNCE UINT8_MAX
+#endif
+
+// Enough bits to hold any count below DEBOUNCE
+#if DEBOUNCE < 2
+#    define COUNTER_BITS 1
+#elif DEBOUNCE < 4
+#    define COUNTER_BITS 2
+#elif DEBOUNCE < 8
+#    define COUNTER_BITS 3
+#elif DEBOUNCE < 16
+#    define COUNTER_BITS 4
+#elif DEBOUNCE < 32
+#    define COUNTER_BITS 5
+#elif DEBOUNCE < 64
+#    define COUNTER_BITS 6
+#elif DEBOUNCE < 128
+#    define COUNTER_BITS 7
+#else
+#    define COUNTER_BITS 8
+#endif
+
+#if DEBOUNCE > 0
+static matrix_row_t debounce_counters[DEBOUNCE_NUM_ROWS][COUNTER_BITS];
+static matrix_row_t debounce_running[DEBOUNCE_NUM_ROWS];
+static fast_timer_t last_time;
+static bool         counters_need_update;
+
+static void update_debounce_counters_and_transfer_if_expired(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, uint8_t elapsed_time);
+static void start_debounce_counters(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows);
+
+// we use num_rows rather than MATRIX_ROWS to support split keyboards
+void debounce_init(uint8_t num_rows) {
+    memset(debounce_counters, 0, sizeof(debounce_counters));
+    memset(debounce_running, 0, sizeof(debounce_running));
+    counters_need_update = false;
+}
+
+void debounce_free(void) {}
+
+void debounce(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, bool changed) {
+    bool updated_last = false;
+
+    if (counters_need_update) {
+        fast_timer_t now          = timer_read_fast();
+        fast_timer_t elapsed_time = TIMER_DIFF_FAST(now, last_time);
+
+        last_time    = now;
+        updated_last = true;
+        if (elapsed_time > UINT8_MAX) {
+            elapsed_time = UINT8_MAX;
+        }
+
+        if (elapsed_time > 0) {
+            update_debounce_counters_and_transfer_if_expired(raw, cooked, num_rows, elapsed_time);
+        }
+    }
+
+    if (changed) {
+        if (!updated_last) {
+            last_time = timer_read_fast();
+        }
+
+        start_debounce_counters(raw, cooked, num_rows);
+    }
+}
+
+// Add elapsed_time to the counters of the running keys, returning the keys that overflowed
+static matrix_row_t add_to_counters(matrix_row_t counters[], matrix_row_t running, uint8_t elapsed_time) {
+    matrix_row_t carry = 0;
+    for (uint8_t bit = 0; bit < COUNTER_BITS; bit++) {
+        matrix_row_t addend = (elapsed_time & (1 << bit)) ? running : 0;
+        matrix_row_t sum    = counters[bit] ^ addend ^ carry;
+
+        carry         = (counters[bit] & addend) | (carry & (counters[bit] ^ addend));
+        counters[bit] = sum;
+    }
+    return carry;
+}
+
+// Keys whose counter is at least DEBOUNCE
+static matrix_row_t counters_expired(const matrix_row_t counters[]) {
+    matrix_row_t greater = 0;
+    matrix_row_t equal   = ~(matrix_row_t)0;
+    for (int8_t bit = COUNTER_BITS - 1; bit >= 0; bit--) {
+        if (DEBOUNCE & (1 << bit)) {
+            equal &= counters[bit];
+        } else {
+            greater |= equal & counters[bit];
+            equal &= ~counters[bit];
+        }
+    }
+    return greater | equal;
+}
+
+static void update_debounce_counters_and_transfer_if_expired(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, uint8_t elapsed_time) {
+    counters_need_update = false;
+    for (uint8_t row = 0; row < num_rows; row++) {
+        matrix_row_t running = debounce_running[row];
+        if (!running) {
+            continue;
+        }
+
+        matrix_row_t expired;
+        if (elapsed_time >= DEBOUNCE) {
+            expired = running;
+        } else {
+            expired = add_to_counters(debounce_counters[row], running, elapsed_time);
+            expired = (expired | counters_expired(debounce_counters[row])) & running;
+        }
+
+        if (expired) {
+            cooked[row]           = (cooked[row] & ~expired) | (raw[row] & expired);
+            debounce_running[row] = running & ~expired;
+            for (uint8_t bit = 0; bit < COUNTER_BITS; bit++) {
+                debounce_counters[row][bit] &= ~expired;
+            }
+        }
+
+        if (debounce_running[row]) {
+            counters_need_update = true;
+        }
+    }
+}
+
+static void start_debounce_counters(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows) {
+    for (uint8_t row = 0; row < num_rows; row++) {
+        matrix_row_t delta = raw[row] ^ cooked[row];
+
+        // Keys that settled back to their debounced state stop counting, new changes start from zero
+        for (uint8_t bit = 0; bit < COUNTER_BITS; bit++) {
+            debounce_counters[row][bit] &= delta;
+        }
+        debounce_running[row] = delta;
+
+        if (delta) {
+            counters_need_update = true;
+        }
+    }
+}
+
+bool debounce_active(void) { return counters_need_update; }
+#else
+#    include "none.c"
+#endif
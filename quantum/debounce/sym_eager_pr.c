@@ -22,13 +22,7 @@ No further inputs are accepted until DEBOUNCE milliseconds have occurred.
 #include "matrix.h"
 #include "timer.h"
 #include "quantum.h"
-#include <stdlib.h>
-
-#ifdef PROTOCOL_CHIBIOS
-#    if CH_CFG_USE_MEMCORE == FALSE
-#        error ChibiOS is configured without a memory allocator. Your keyboard may have set `#define CH_CFG_USE_MEMCORE FALSE`, which is incompatible with this debounce algorithm.
-#    endif
-#endif
+#include "debounce.h"
 
 #ifndef DEBOUNCE
 #    define DEBOUNCE 5
@@ -45,9 +39,9 @@ typedef uint8_t debounce_counter_t;
 #if DEBOUNCE > 0
 static bool matrix_need_update;
 
-static debounce_counter_t *debounce_counters;
-static fast_timer_t        last_time;
-static bool                counters_need_update;
+static debounce_counter_t debounce_counters[DEBOUNCE_NUM_ROWS];
+static fast_timer_t       last_time;
+static bool               counters_need_update;
 
 #    define DEBOUNCE_ELAPSED 0
 
@@ -56,16 +50,12 @@ static void transfer_matrix_values(matrix_row_t raw[], matrix_row_t cooked[], ui
 
 // we use num_rows rather than MATRIX_ROWS to support split keyboards
 void debounce_init(uint8_t num_rows) {
-    debounce_counters = (debounce_counter_t *)malloc(num_rows * sizeof(debounce_counter_t));
     for (uint8_t r = 0; r < num_rows; r++) {
         debounce_counters[r] = DEBOUNCE_ELAPSED;
     }
 }
 
-void debounce_free(void) {
-    free(debounce_counters);
-    debounce_counters = NULL;
-}
+void debounce_free(void) {}
 
 void debounce(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, bool changed) {
     bool updated_last = false;
@@ -0,0 +1,68 @@
+/* Copyright 2022 QMK
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "gtest/gtest.h"
+
+#include <chrono>
+#include <iostream>
+
+extern "C" {
+#include "quantum.h"
+#include "timer.h"
+#include "debounce.h"
+
+void set_time(uint32_t t);
+void advance_time(uint32_t ms);
+}
+
+/* Time debounce() while every key bounces, so the per-key state is always busy */
+TEST(DebounceBenchmark, AllKeysBouncing) {
+    const uint32_t scans = 100000;
+    matrix_row_t   raw[MATRIX_ROWS]    = {0};
+    matrix_row_t   cooked[MATRIX_ROWS] = {0};
+    uint32_t       cooked_changes      = 0;
+
+    debounce_init(MATRIX_ROWS);
+    set_time(1000);
+
+    // Each key toggles every DEBOUNCE + 1 ms, staggered by column, so the inputs repeat with that period
+    matrix_row_t inputs[DEBOUNCE + 1][MATRIX_ROWS];
+    for (uint8_t step = 0; step <= DEBOUNCE; step++) {
+        for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+            for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+                if ((step + col) % (DEBOUNCE + 1) == 0) {
+                    raw[row] ^= (matrix_row_t)1 << col;
+                }
+            }
+            inputs[step][row] = raw[row];
+        }
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < scans; i++) {
+        matrix_row_t previous = cooked[0];
+        debounce(inputs[i % (DEBOUNCE + 1)], cooked, MATRIX_ROWS, true);
+        cooked_changes += previous != cooked[0];
+        advance_time(1);
+    }
+    auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+
+    debounce_free();
+
+    EXPECT_GT(cooked_changes, 0);
+    std::cout << "[ BENCHMARK] " << MATRIX_ROWS << "x" << MATRIX_COLS << " matrix: " << (double)elapsed / scans << " ns per scan" << std::endl;
+    RecordProperty("ns_per_scan", (int)(elapsed / scans));
+}
@@ -81,6 +81,37 @@
 #    define DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE (DYNAMIC_KEYMAP_EEPROM_MAX_ADDR - DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + 1)
 #endif
 
+#define DYNAMIC_KEYMAP_EEPROM_SIZE (DYNAMIC_KEYMAP_LAYER_COUNT * MATRIX_ROWS * MATRIX_COLS * 2)
+
+#ifdef DYNAMIC_KEYMAP_RAM_CACHE
+// RAM mirror of the keymaps stored in EEPROM, so that keycode lookups
+// (once per active layer per key event) never touch the EEPROM driver.
+// Writes go through to EEPROM and update the mirror at the same time.
+static uint16_t dynamic_keymap_cache[DYNAMIC_KEYMAP_LAYER_COUNT][MATRIX_ROWS][MATRIX_COLS];
+static bool     dynamic_keymap_cache_valid = false;
+
+void dynamic_keymap_cache_load(void) {
+    uint8_t *bytes = (uint8_t *)dynamic_keymap_cache;
+    eeprom_read_block(bytes, (void *)DYNAMIC_KEYMAP_EEPROM_ADDR, DYNAMIC_KEYMAP_EEPROM_SIZE);
+    // EEPROM contents are big endian, convert in place
+    uint16_t *keycode = (uint16_t *)dynamic_keymap_cache;
+    for (uint16_t i = 0; i < DYNAMIC_KEYMAP_EEPROM_SIZE; i += 2) {
+        *keycode++ = (bytes[i] << 8) | bytes[i + 1];
+    }
+    dynamic_keymap_cache_valid = true;
+    clear_resolved_layers_cache();
+}
+
+static inline void dynamic_keymap_cache_update_byte(uint16_t offset, uint8_t value) {
+    uint16_t *keycode = &((uint16_t *)dynamic_keymap_cache)[offset / 2];
+    if (offset & 1) {
+        *keycode = (*keycode & 0xFF00) | value;
+    } else {
+        *keycode = (*keycode & 0x00FF) | (value << 8);
+    }
+}
+#endif
+
 uint8_t dynamic_keymap_get_layer_count(void) { return DYNAMIC_KEYMAP_LAYER_COUNT; }
 
 void *dynamic_keymap_key_to_eeprom_address(uint8_t layer, uint8_t row, uint8_t column) {
@@ -89,11 +120,21 @@ void *dynamic_keymap_key_to_eeprom_address(uint8_t layer, uint8_t row, uint8_t c
 }
 
 uint16_t dynamic_keymap_get_keycode(uint8_t layer, uint8_t row, uint8_t column) {
+#ifdef DYNAMIC_KEYMAP_RAM_CACHE
+    if (layer >= DYNAMIC_KEYMAP_LAYER_COUNT || row >= MATRIX_ROWS || column >= MATRIX_COLS) {
+        return KC_NO;
+    }
+    if (!dynamic_keymap_cache_valid) {
+        dynamic_keymap_cache_load();
+    }
+    return dynamic_keymap_cache[layer][row][column];
+#else
     void *address = dynamic_keymap_key_to_eeprom_address(layer, row, column);
     // Big endian, so we can read/write EEPROM directly from host if we want
     uint16_t keycode = eeprom_read_byte(address) << 8;
     keycode |= eeprom_read_byte(address + 1);
     return keycode;
+#endif
 }
 
 void dynamic_keymap_set_keycode(uint8_t layer, uint8_t row, uint8_t column, uint16_t keycode) {
@@ -101,12 +142,19 @@ void dynamic_keymap_set_keycode(uint8_t layer, uint8_t row, uint8_t column, uint
     // Big endian, so we can read/write EEPROM directly from host if we want
     eeprom_update_byte(address, (uint8_t)(keycode >> 8));
     eeprom_update_byte(address + 1, (uint8_t)(keycode & 0xFF));
+#ifdef DYNAMIC_KEYMAP_RAM_CACHE
+    if (layer < DYNAMIC_KEYMAP_LAYER_COUNT && row < MATRIX_ROWS && column < MATRIX_COLS) {
+        dynamic_keymap_cache[layer][row][column] = keycode;
+    }
+#endif
+    clear_resolved_layers_cache();
 }
 
 void dynamic_keymap_reset(void) {
     // Reset the keymaps in EEPROM to what is in flash.
     // All keyboards using dynamic keymaps should define a layout
     // for the same number of layers as DYNAMIC_KEYMAP_LAYER_COUNT.
+    eeprom_transaction_begin();
     for (int layer = 0; layer < DYNAMIC_KEYMAP_LAYER_COUNT; layer++) {
         for (int row = 0; row < MATRIX_ROWS; row++) {
             for (int column = 0; column < MATRIX_COLS; column++) {
@@ -114,15 +162,30 @@ void dynamic_keymap_reset(void) {
             }
         }
     }
+    eeprom_transaction_commit();
+#ifdef DYNAMIC_KEYMAP_RAM_CACHE
+    // Every entry was just written through, so the mirror is complete
+    dynamic_keymap_cache_valid = true;
+#endif
 }
 
 void dynamic_keymap_get_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
-    uint16_t dynamic_keymap_eeprom_size = DYNAMIC_KEYMAP_LAYER_COUNT * MATRIX_ROWS * MATRIX_COLS * 2;
+    uint16_t dynamic_keymap_eeprom_size = DYNAMIC_KEYMAP_EEPROM_SIZE;
     void *   source                     = (void *)(DYNAMIC_KEYMAP_EEPROM_ADDR + offset);
     uint8_t *target                     = data;
+#ifdef DYNAMIC_KEYMAP_RAM_CACHE
+    if (!dynamic_keymap_cache_valid) {
+        dynamic_keymap_cache_load();
+    }
+#endif
     for (uint16_t i = 0; i < size; i++) {
         if (offset + i < dynamic_keymap_eeprom_size) {
+#ifdef DYNAMIC_KEYMAP_RAM_CACHE
+            uint16_t keycode = ((uint16_t *)dynamic_keymap_cache)[(offset + i) / 2];
+            *target          = ((offset + i) & 1) ? (keycode & 0xFF) : (keycode >> 8);
+#else
             *target = eeprom_read_byte(source);
+#endif
         } else {
             *target = 0x00;
         }
@@ -132,16 +195,22 @@ void dynamic_keymap_get_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
 }
 
 void dynamic_keymap_set_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
-    uint16_t dynamic_keymap_eeprom_size = DYNAMIC_KEYMAP_LAYER_COUNT * MATRIX_ROWS * MATRIX_COLS * 2;
+    uint16_t dynamic_keymap_eeprom_size = DYNAMIC_KEYMAP_EEPROM_SIZE;
     void *   target                     = (void *)(DYNAMIC_KEYMAP_EEPROM_ADDR + offset);
     uint8_t *source                     = data;
+    eeprom_transaction_begin();
     for (uint16_t i = 0; i < size; i++) {
         if (offset + i < dynamic_keymap_eeprom_size) {
             eeprom_update_byte(target, *source);
+#ifdef DYNAMIC_KEYMAP_RAM_CACHE
+            dynamic_keymap_cache_update_byte(offset + i, *source);
+#endif
         }
         source++;
         target++;
     }
+    eeprom_transaction_commit();
+    clear_resolved_layers_cache();
 }
 
 // This overrides the one in quantum/keymap_common.c
@@ -174,6 +243,7 @@ void dynamic_keymap_macro_get_buffer(uint16_t offset, uint16_t size, uint8_t *da
 void dynamic_keymap_macro_set_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
     void *   target = (void *)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + offset);
     uint8_t *source = data;
+    eeprom_transaction_begin();
     for (uint16_t i = 0; i < size; i++) {
         if (offset + i < DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE) {
             eeprom_update_byte(target, *source);
@@ -181,15 +251,18 @@ void dynamic_keymap_macro_set_buffer(uint16_t offset, uint16_t size, uint8_t *da
         source++;
         target++;
     }
+    eeprom_transaction_commit();
 }
 
 void dynamic_keymap_macro_reset(void) {
     void *p   = (void *)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR);
     void *end = (void *)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE);
+    eeprom_transaction_begin();
     while (p != end) {
         eeprom_update_byte(p, 0);
         ++p;
     }
+    eeprom_transaction_commit();
 }
 
 void dynamic_keymap_macro_send(uint8_t id) {
@@ -23,6 +23,10 @@ void *   dynamic_keymap_key_to_eeprom_address(uint8_t layer, uint8_t row, uint8_
 uint16_t dynamic_keymap_get_keycode(uint8_t layer, uint8_t row, uint8_t column);
 void     dynamic_keymap_set_keycode(uint8_t layer, uint8_t row, uint8_t column, uint16_t keycode);
 void     dynamic_keymap_reset(void);
+// With DYNAMIC_KEYMAP_RAM_CACHE defined, keycodes are served from a RAM copy
+// of the keymaps. This (re)loads it from EEPROM; it is otherwise loaded on
+// first use, and kept up to date by the setters above and below.
+void dynamic_keymap_cache_load(void);
 // These get/set the keycodes as stored in the EEPROM buffer
 // Data is big-endian 16-bit values (the keycodes)
 // Order is by layer/row/column
@@ -0,0 +1,117 @@
+/* Copyright 2022 QMK
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "dynamic_keymap.h"
+#include "dynamic_keymap/tests/mock.h"
+}
+
+class DynamicKeymap : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        mock_eeprom_reset();
+        for (uint8_t layer = 0; layer < DYNAMIC_KEYMAP_LAYER_COUNT; layer++) {
+            for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+                for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+                    keymaps[layer][row][col] = (layer << 12) | (row << 8) | (col << 4) | 0xA;
+                }
+            }
+        }
+        dynamic_keymap_reset();
+        mock_eeprom_reads  = 0;
+        mock_eeprom_writes = 0;
+    }
+
+    // Worst case for layer_switch_get_layer(): a transparent key on every layer
+    uint32_t reads_for_keypress(uint8_t row, uint8_t col) {
+        uint32_t before = mock_eeprom_reads;
+        for (int8_t layer = DYNAMIC_KEYMAP_LAYER_COUNT - 1; layer >= 0; layer--) {
+            dynamic_keymap_get_keycode(layer, row, col);
+        }
+        return mock_eeprom_reads - before;
+    }
+};
+
+TEST_F(DynamicKeymap, ResetCopiesKeymapToEeprom) {
+    EXPECT_EQ(mock_eeprom[DYNAMIC_KEYMAP_EEPROM_ADDR + 0], 0x00);
+    EXPECT_EQ(mock_eeprom[DYNAMIC_KEYMAP_EEPROM_ADDR + 1], 0x0A);
+    EXPECT_EQ(dynamic_keymap_get_keycode(3, 2, 1), 0x321A);
+    EXPECT_EQ(dynamic_keymap_get_keycode(0, MATRIX_ROWS - 1, MATRIX_COLS - 1), ((MATRIX_ROWS - 1) << 8) | ((MATRIX_COLS - 1) << 4) | 0xA);
+}
+
+TEST_F(DynamicKeymap, SetKeycodeIsWrittenThrough) {
+    dynamic_keymap_set_keycode(1, 2, 3, 0xBEEF);
+    EXPECT_EQ(dynamic_keymap_get_keycode(1, 2, 3), 0xBEEF);
+
+    uint8_t *address = (uint8_t *)dynamic_keymap_key_to_eeprom_address(1, 2, 3);
+    EXPECT_EQ(mock_eeprom[(uintptr_t)address], 0xBE);
+    EXPECT_EQ(mock_eeprom[(uintptr_t)address + 1], 0xEF);
+}
+
+TEST_F(DynamicKeymap, SetBufferIsWrittenThrough) {
+    // Unaligned write straddling two keycodes
+    uint8_t  data[] = {0x12, 0x34, 0x56};
+    uint16_t offset = (MATRIX_COLS * 2) + 1;
+    dynamic_keymap_get_keycode(0, 1, 0);
+    dynamic_keymap_set_buffer(offset, sizeof(data), data);
+
+    EXPECT_EQ(dynamic_keymap_get_keycode(0, 1, 0), 0x0112);
+    EXPECT_EQ(dynamic_keymap_get_keycode(0, 1, 1), 0x3456);
+    EXPECT_EQ(mock_eeprom[DYNAMIC_KEYMAP_EEPROM_ADDR + offset], 0x12);
+
+    uint8_t readback[4] = {0};
+    dynamic_keymap_get_buffer(offset - 1, sizeof(readback), readback);
+    EXPECT_EQ(readback[0], 0x01);
+    EXPECT_EQ(readback[1], 0x12);
+    EXPECT_EQ(readback[2], 0x34);
+    EXPECT_EQ(readback[3], 0x56);
+}
+
+TEST_F(DynamicKeymap, GetBufferPastEndIsZero) {
+    uint16_t size = DYNAMIC_KEYMAP_LAYER_COUNT * MATRIX_ROWS * MATRIX_COLS * 2;
+    uint8_t  readback[4];
+    dynamic_keymap_get_buffer(size - 2, sizeof(readback), readback);
+    EXPECT_EQ(readback[0], (uint8_t)(keymaps[3][MATRIX_ROWS - 1][MATRIX_COLS - 1] >> 8));
+    EXPECT_EQ(readback[1], (uint8_t)(keymaps[3][MATRIX_ROWS - 1][MATRIX_COLS - 1] & 0xFF));
+    EXPECT_EQ(readback[2], 0);
+    EXPECT_EQ(readback[3], 0);
+}
+
+#ifdef DYNAMIC_KEYMAP_RAM_CACHE
+TEST_F(DynamicKeymap, ExternalEepromChangeIsPickedUpOnLoad) {
+    uint8_t *address = (uint8_t *)dynamic_keymap_key_to_eeprom_address(2, 0, 0);
+    mock_eeprom[(uintptr_t)address]     = 0xCA;
+    mock_eeprom[(uintptr_t)address + 1] = 0xFE;
+    dynamic_keymap_cache_load();
+    EXPECT_EQ(dynamic_keymap_get_keycode(2, 0, 0), 0xCAFE);
+}
+#endif
+
+TEST_F(DynamicKeymap, EepromReadsPerKeypress) {
+    const uint32_t keypresses = 1000;
+    uint32_t       reads      = 0;
+    for (uint32_t i = 0; i < keypresses; i++) {
+        reads += reads_for_keypress(i % MATRIX_ROWS, i % MATRIX_COLS);
+    }
+    printf("EEPROM reads per keypress across %d layers: %.3f\n", DYNAMIC_KEYMAP_LAYER_COUNT, (double)reads / keypresses);
+#ifdef DYNAMIC_KEYMAP_RAM_CACHE
+    EXPECT_EQ(reads, 0u);
+#else
+    EXPECT_EQ(reads, keypresses * DYNAMIC_KEYMAP_LAYER_COUNT * 2);
+#endif
+}
@@ -0,0 +1,50 @@
+/* Copyright 2022 QMK
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <string.h>
+#include "eeprom.h"
+#include "mock.h"
+
+uint8_t  mock_eeprom[MOCK_EEPROM_SIZE];
+uint32_t mock_eeprom_reads;
+uint32_t mock_eeprom_writes;
+
+// Stands in for the keymap in flash that dynamic_keymap_reset() copies from
+uint16_t keymaps[DYNAMIC_KEYMAP_LAYER_COUNT][MATRIX_ROWS][MATRIX_COLS];
+
+void mock_eeprom_reset(void) {
+    memset(mock_eeprom, 0, sizeof(mock_eeprom));
+    mock_eeprom_reads  = 0;
+    mock_eeprom_writes = 0;
+}
+
+uint8_t eeprom_read_byte(const uint8_t *addr) {
+    mock_eeprom_reads++;
+    return mock_eeprom[(uintptr_t)addr];
+}
+
+void eeprom_read_block(void *buf, const void *addr, size_t len) {
+    // A block read is a single transaction on I2C/SPI EEPROMs
+    mock_eeprom_reads++;
+    memcpy(buf, &mock_eeprom[(uintptr_t)addr], len);
+}
+
+void eeprom_update_byte(uint8_t *addr, uint8_t value) {
+    mock_eeprom_writes++;
+    mock_eeprom[(uintptr_t)addr] = value;
+}
+
+void send_string(const char *str) {}
@@ -0,0 +1,16 @@
+DYNAMIC_KEYMAP_COMMON_DEFS := -DNO_DEBUG
+
+DYNAMIC_KEYMAP_COMMON_INC := $(QUANTUM_PATH)/dynamic_keymap/tests
+
+DYNAMIC_KEYMAP_COMMON_SRC := \
+	$(QUANTUM_PATH)/dynamic_keymap/tests/mock.c \
+	$(QUANTUM_PATH)/dynamic_keymap/tests/dynamic_keymap_tests.cpp \
+	$(QUANTUM_PATH)/dynamic_keymap.c
+
+dynamic_keymap_DEFS := $(DYNAMIC_KEYMAP_COMMON_DEFS)
+dynamic_keymap_INC := $(DYNAMIC_KEYMAP_COMMON_INC)
+dynamic_keymap_SRC := $(DYNAMIC_KEYMAP_COMMON_SRC)
+
+dynamic_keymap_cache_DEFS := $(DYNAMIC_KEYMAP_COMMON_DEFS) -DDYNAMIC_KEYMAP_RAM_CACHE
+dynamic_keymap_cache_INC := $(DYNAMIC_KEYMAP_COMMON_INC)
+dynamic_keymap_cache_SRC := $(DYNAMIC_KEYMAP_COMMON_SRC)
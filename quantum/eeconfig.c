@@ -39,8 +39,13 @@ __attribute__((weak)) void eeconfig_init_kb(void) {
  */
 void eeconfig_init_quantum(void) {
 #if defined(EEPROM_DRIVER)
+#    ifdef EEPROM_WRITE_BEHIND_ENABLE
+    eeprom_write_behind_discard();
+#    endif
     eeprom_driver_erase();
 #endif
+    // Lands as a whole or not at all on drivers that support it
+    eeprom_transaction_begin();
     eeprom_update_word(EECONFIG_MAGIC, EECONFIG_MAGIC_NUMBER);
     eeprom_update_byte(EECONFIG_DEBUG, 0);
     eeprom_update_byte(EECONFIG_DEFAULT_LAYER, 0);
@@ -84,6 +89,7 @@ void eeconfig_init_quantum(void) {
 #endif
 
     eeconfig_init_kb();
+    eeprom_transaction_commit();
 }
 
 /** \brief eeconfig initialization
@@ -104,6 +110,9 @@ void eeconfig_enable(void) { eeprom_update_word(EECONFIG_MAGIC, EECONFIG_MAGIC_N
  */
 void eeconfig_disable(void) {
 #if defined(EEPROM_DRIVER)
+#    ifdef EEPROM_WRITE_BEHIND_ENABLE
+    eeprom_write_behind_discard();
+#    endif
     eeprom_driver_erase();
 #endif
     eeprom_update_word(EECONFIG_MAGIC, EECONFIG_MAGIC_NUMBER_OFF);
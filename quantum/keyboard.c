@@ -97,9 +97,26 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #ifdef VIRTSER_ENABLE
 #    include "virtser.h"
 #endif
+#ifdef COMBO_ENABLE
+#    include "process_combo.h"
+#endif
 #ifdef SLEEP_LED_ENABLE
 #    include "sleep_led.h"
 #endif
+#ifdef SEND_STRING_QUEUE_SIZE
+#    include "send_string.h"
+#endif
+#ifdef DEFERRED_INIT_ENABLE
+#    include "deferred_exec.h"
+#    include "usb_device_state.h"
+#endif
+#if defined(SPLIT_KEYBOARD) && defined(SPLIT_MATRIX_EVENT_LOG_SIZE)
+#    include "transactions.h"
+// Slave-side changes carry the time the slave scanned them, rather than when they crossed the transport
+#    define key_event_time(row, col, scan_time) split_matrix_event_time(row, col, scan_time)
+#else
+#    define key_event_time(row, col, scan_time) (scan_time)
+#endif
 
 static uint32_t last_input_modification_time = 0;
 uint32_t        last_input_activity_time(void) { return last_input_modification_time; }
@@ -115,19 +132,48 @@ uint32_t        last_encoder_activity_time(void) { return last_encoder_modificat
 uint32_t        last_encoder_activity_elapsed(void) { return timer_elapsed32(last_encoder_modification_time); }
 void            last_encoder_activity_trigger(void) { last_encoder_modification_time = last_input_modification_time = timer_read32(); }
 
+#ifdef KEY_EVENT_QUEUE_SIZE
+#    ifdef QMK_KEYS_PER_SCAN
+#        error "KEY_EVENT_QUEUE_SIZE and QMK_KEYS_PER_SCAN cannot be used together"
+#    endif
+#    if KEY_EVENT_QUEUE_SIZE > 255
+#        error "KEY_EVENT_QUEUE_SIZE must be less than 256"
+#    endif
+static keyevent_t key_event_queue[KEY_EVENT_QUEUE_SIZE];
+static uint8_t    key_event_queue_count      = 0;
+static uint8_t    key_event_queue_high_water = 0;
+uint8_t           key_event_queue_last_count(void) { return key_event_queue_count; }
+uint8_t           key_event_queue_high_water_mark(void) { return key_event_queue_high_water; }
+#endif
+
 // Only enable this if console is enabled to print to
 #if defined(DEBUG_MATRIX_SCAN_RATE)
 static uint32_t matrix_timer           = 0;
 static uint32_t matrix_scan_count      = 0;
 static uint32_t last_matrix_scan_count = 0;
+#    ifdef MATRIX_WAKE_ENABLE
+static uint32_t matrix_idle_start      = 0;
+static uint8_t  last_matrix_idle_ratio = 0;
+#    endif
 
 void matrix_scan_perf_task(void) {
     matrix_scan_count++;
 
     uint32_t timer_now = timer_read32();
     if (TIMER_DIFF_32(timer_now, matrix_timer) > 1000) {
+#    ifdef MATRIX_WAKE_ENABLE
+        uint32_t matrix_idle_now = matrix_idle_time();
+        last_matrix_idle_ratio   = (matrix_idle_now - matrix_idle_start) * 100 / TIMER_DIFF_32(timer_now, matrix_timer);
+        matrix_idle_start        = matrix_idle_now;
+#    endif
 #    if defined(CONSOLE_ENABLE)
         dprintf("matrix scan frequency: %lu\n", matrix_scan_count);
+#        ifdef MATRIX_WAKE_ENABLE
+        dprintf("matrix idle: %u%%\n", last_matrix_idle_ratio);
+#        endif
+#        ifdef KEY_EVENT_QUEUE_SIZE
+        dprintf("key event queue high water mark: %u/%u\n", key_event_queue_high_water, KEY_EVENT_QUEUE_SIZE);
+#        endif
 #    endif
         last_matrix_scan_count = matrix_scan_count;
         matrix_timer           = timer_now;
@@ -136,10 +182,107 @@ void matrix_scan_perf_task(void) {
 }
 
 uint32_t get_matrix_scan_rate(void) { return last_matrix_scan_count; }
+#    ifdef MATRIX_WAKE_ENABLE
+uint8_t get_matrix_idle_ratio(void) { return last_matrix_idle_ratio; }
+#    endif
 #else
 #    define matrix_scan_perf_task()
 #endif
 
+#if defined(BOOT_TIMELINE_ENABLE) || defined(DEFERRED_INIT_ENABLE)
+static uint32_t boot_start_time = 0;
+static bool     first_scan_done = false;
+#endif
+
+#ifdef BOOT_TIMELINE_ENABLE
+#    ifndef BOOT_TIMELINE_SIZE
+#        define BOOT_TIMELINE_SIZE 24
+#    endif
+static boot_timeline_entry_t boot_timeline[BOOT_TIMELINE_SIZE];
+static uint8_t               boot_timeline_length = 0;
+
+uint8_t boot_timeline_count(void) { return boot_timeline_length; }
+
+const boot_timeline_entry_t *boot_timeline_get(uint8_t index) { return index < boot_timeline_length ? &boot_timeline[index] : NULL; }
+
+static void boot_timeline_record(const char *name, uint32_t start) {
+    if (boot_timeline_length < BOOT_TIMELINE_SIZE) {
+        boot_timeline[boot_timeline_length++] = (boot_timeline_entry_t){.name = name, .start = TIMER_DIFF_32(start, boot_start_time), .duration = timer_elapsed32(start)};
+    }
+}
+
+void boot_timeline_print(void) {
+    for (uint8_t i = 0; i < boot_timeline_length; i++) {
+        dprintf("boot: %5lu ms +%4lu ms %s\n", boot_timeline[i].start, boot_timeline[i].duration, boot_timeline[i].name);
+    }
+}
+
+// Times a single step of startup
+#    define BOOT_STEP(name, step)                        \
+        do {                                             \
+            uint32_t boot_step_start = timer_read32();   \
+            step;                                        \
+            boot_timeline_record(name, boot_step_start); \
+        } while (0)
+#else
+#    define BOOT_STEP(name, step) step
+#    define boot_timeline_record(name, start)
+#    define boot_timeline_print()
+#endif
+
+#ifdef DEFERRED_INIT_ENABLE
+#    ifndef DEFERRED_EXEC_ENABLE
+#        error "DEFERRED_INIT_ENABLE requires DEFERRED_EXEC_ENABLE = yes in rules.mk"
+#    endif
+#    ifndef DEFERRED_INIT_TIMEOUT
+#        define DEFERRED_INIT_TIMEOUT 1000
+#    endif
+static bool deferred_init_done = false;
+
+bool keyboard_deferred_init_done(void) { return deferred_init_done; }
+
+/** \brief keyboard_deferred_init_kb
+ *
+ * Override this function to initialise slow peripherals once keys are already working.
+ */
+__attribute__((weak)) void keyboard_deferred_init_kb(void) { keyboard_deferred_init_user(); }
+
+/** \brief keyboard_deferred_init_user
+ *
+ * Override this function to initialise slow peripherals once keys are already working.
+ */
+__attribute__((weak)) void keyboard_deferred_init_user(void) {}
+
+/** \brief deferred_init
+ *
+ * Brings up the slow peripherals once the first scan is done and the host has configured the keyboard,
+ * or after DEFERRED_INIT_TIMEOUT if it never does.
+ */
+static uint32_t deferred_init(uint32_t trigger_time, void *cb_arg) {
+    if (!first_scan_done) {
+        return 1;
+    }
+    if (is_keyboard_master() && usb_device_state != USB_DEVICE_STATE_CONFIGURED && timer_elapsed32(boot_start_time) < DEFERRED_INIT_TIMEOUT) {
+        return 1;
+    }
+
+#    ifdef OLED_ENABLE
+    BOOT_STEP("oled", oled_init(OLED_ROTATION_0));
+#    endif
+#    ifdef ST7565_ENABLE
+    BOOT_STEP("st7565", st7565_init(DISPLAY_ROTATION_0));
+#    endif
+#    ifdef POINTING_DEVICE_ENABLE
+    BOOT_STEP("pointing device", pointing_device_init());
+#    endif
+    BOOT_STEP("keyboard_deferred_init_kb", keyboard_deferred_init_kb());
+    deferred_init_done = true;
+
+    if (debug_enable) boot_timeline_print();
+    return 0;
+}
+#endif
+
 #ifdef MATRIX_HAS_GHOST
 extern const uint16_t keymaps[][MATRIX_ROWS][MATRIX_COLS];
 static matrix_row_t   get_real_keys(uint8_t row, matrix_row_t rowdata) {
@@ -296,44 +439,51 @@ void housekeeping_task(void) {
  */
 void keyboard_init(void) {
     timer_init();
+#if defined(BOOT_TIMELINE_ENABLE) || defined(DEFERRED_INIT_ENABLE)
+    boot_start_time = timer_read32();
+    first_scan_done = false;
+#endif
+#ifdef BOOT_TIMELINE_ENABLE
+    boot_timeline_length = 0;
+#endif
     sync_timer_init();
 #ifdef VIA_ENABLE
-    via_init();
+    BOOT_STEP("via", via_init());
 #endif
-    matrix_init();
+    BOOT_STEP("matrix", matrix_init());
 #if defined(CRC_ENABLE)
     crc_init();
 #endif
-#ifdef OLED_ENABLE
-    oled_init(OLED_ROTATION_0);
+#if defined(OLED_ENABLE) && !defined(DEFERRED_INIT_ENABLE)
+    BOOT_STEP("oled", oled_init(OLED_ROTATION_0));
 #endif
-#ifdef ST7565_ENABLE
-    st7565_init(DISPLAY_ROTATION_0);
+#if defined(ST7565_ENABLE) && !defined(DEFERRED_INIT_ENABLE)
+    BOOT_STEP("st7565", st7565_init(DISPLAY_ROTATION_0));
 #endif
 #ifdef PS2_MOUSE_ENABLE
-    ps2_mouse_init();
+    BOOT_STEP("ps2 mouse", ps2_mouse_init());
 #endif
 #ifdef BACKLIGHT_ENABLE
-    backlight_init();
+    BOOT_STEP("backlight", backlight_init());
 #endif
 #ifdef RGBLIGHT_ENABLE
-    rgblight_init();
+    BOOT_STEP("rgblight", rgblight_init());
 #endif
 #ifdef ENCODER_ENABLE
-    encoder_init();
+    BOOT_STEP("encoder", encoder_init());
 #endif
 #ifdef STENO_ENABLE
     steno_init();
 #endif
-#ifdef POINTING_DEVICE_ENABLE
-    pointing_device_init();
+#if defined(POINTING_DEVICE_ENABLE) && !defined(DEFERRED_INIT_ENABLE)
+    BOOT_STEP("pointing device", pointing_device_init());
 #endif
 #if defined(NKRO_ENABLE) && defined(FORCE_NKRO)
     keymap_config.nkro = 1;
     eeconfig_update_keymap(keymap_config.raw);
 #endif
 #ifdef DIP_SWITCH_ENABLE
-    dip_switch_init();
+    BOOT_STEP("dip switch", dip_switch_init());
 #endif
 #ifdef SLEEP_LED_ENABLE
     sleep_led_init();
@@ -341,12 +491,20 @@ void keyboard_init(void) {
 #ifdef VIRTSER_ENABLE
     virtser_init();
 #endif
+#ifdef COMBO_ENABLE
+    BOOT_STEP("combo", combo_init());
+#endif
 
 #if defined(DEBUG_MATRIX_SCAN_RATE) && defined(CONSOLE_ENABLE)
     debug_enable = true;
 #endif
 
-    keyboard_post_init_kb(); /* Always keep this last */
+#ifdef DEFERRED_INIT_ENABLE
+    deferred_init_done = false;
+    defer_exec(1, deferred_init, NULL);
+#endif
+
+    BOOT_STEP("keyboard_post_init_kb", keyboard_post_init_kb()); /* Always keep this last */
 }
 
 /** \brief key_event_task
@@ -363,6 +521,62 @@ void switch_events(uint8_t row, uint8_t col, bool pressed) {
 #endif
 }
 
+#ifdef KEY_EVENT_QUEUE_SIZE
+/** \brief key_event_queue_fill
+ *
+ * Turns the difference between the previous and current matrix into a batch of key events,
+ * all stamped with the time of the scan. Changes that don't fit are left for the next scan.
+ */
+static uint8_t key_event_queue_fill(matrix_row_t *matrix_prev) {
+    uint16_t scan_time    = timer_read() | 1; /* time should not be 0 */
+    key_event_queue_count = 0;
+
+    for (uint8_t r = 0; r < MATRIX_ROWS; r++) {
+        matrix_row_t matrix_row    = matrix_get_row(r);
+        matrix_row_t matrix_change = matrix_row ^ matrix_prev[r];
+        if (matrix_change) {
+#    ifdef MATRIX_HAS_GHOST
+            if (has_ghost_in_row(r, matrix_row)) {
+                continue;
+            }
+#    endif
+            if (debug_matrix) matrix_print();
+            matrix_row_t col_mask = 1;
+            for (uint8_t c = 0; c < MATRIX_COLS; c++, col_mask <<= 1) {
+                if (matrix_change & col_mask) {
+                    if (key_event_queue_count >= KEY_EVENT_QUEUE_SIZE) {
+                        goto QUEUE_FULL;
+                    }
+                    key_event_queue[key_event_queue_count++] = (keyevent_t){.key = (keypos_t){.row = r, .col = c}, .pressed = (matrix_row & col_mask), .time = key_event_time(r, c, scan_time)};
+                    // record a queued key
+                    matrix_prev[r] ^= col_mask;
+                }
+            }
+        }
+    }
+
+QUEUE_FULL:
+    if (key_event_queue_count > key_event_queue_high_water) {
+        key_event_queue_high_water = key_event_queue_count;
+    }
+    return key_event_queue_count;
+}
+
+/** \brief key_event_queue_drain
+ *
+ * Processes every queued key event in scan order.
+ */
+static void key_event_queue_drain(void) {
+    for (uint8_t i = 0; i < key_event_queue_count; i++) {
+        keyevent_t event = key_event_queue[i];
+        if (should_process_keypress()) {
+            action_exec(event);
+        }
+        switch_events(event.key.row, event.key.col, event.pressed);
+    }
+}
+#endif
+
 /** \brief Keyboard task: Do keyboard routine jobs
  *
  * Do routine keyboard jobs:
@@ -376,9 +590,11 @@ void switch_events(uint8_t row, uint8_t col, bool pressed) {
  */
 void keyboard_task(void) {
     static matrix_row_t matrix_prev[MATRIX_ROWS];
-    static uint8_t      led_status    = 0;
-    matrix_row_t        matrix_row    = 0;
-    matrix_row_t        matrix_change = 0;
+    static uint8_t      led_status = 0;
+#ifndef KEY_EVENT_QUEUE_SIZE
+    matrix_row_t matrix_row    = 0;
+    matrix_row_t matrix_change = 0;
+#endif
 #ifdef QMK_KEYS_PER_SCAN
     uint8_t keys_processed = 0;
 #endif
@@ -386,9 +602,21 @@ void keyboard_task(void) {
     bool encoders_changed = false;
 #endif
 
+#ifdef BOOT_TIMELINE_ENABLE
+    uint32_t task_start = first_scan_done ? 0 : timer_read32();
+#endif
+
     uint8_t matrix_changed = matrix_scan();
     if (matrix_changed) last_matrix_activity_trigger();
 
+#ifdef KEY_EVENT_QUEUE_SIZE
+    if (key_event_queue_fill(matrix_prev)) {
+        key_event_queue_drain();
+    } else {
+        // call with pseudo tick event when no real key event.
+        action_exec(TICK);
+    }
+#else
     for (uint8_t r = 0; r < MATRIX_ROWS; r++) {
         matrix_row    = matrix_get_row(r);
         matrix_change = matrix_row ^ matrix_prev[r];
@@ -404,7 +632,7 @@ void keyboard_task(void) {
                 if (matrix_change & col_mask) {
                     if (should_process_keypress()) {
                         action_exec((keyevent_t){
-                            .key = (keypos_t){.row = r, .col = c}, .pressed = (matrix_row & col_mask), .time = (timer_read() | 1) /* time should not be 0 */
+                            .key = (keypos_t){.row = r, .col = c}, .pressed = (matrix_row & col_mask), .time = key_event_time(r, c, timer_read() | 1) /* time should not be 0 */
                         });
                     }
                     // record a processed key
@@ -430,6 +658,19 @@ void keyboard_task(void) {
         action_exec(TICK);
 
 MATRIX_LOOP_END:
+#endif
+
+#ifdef HOST_REPORT_QUEUE_SIZE
+    host_report_task();
+#endif
+
+#ifdef EEPROM_WRITE_BEHIND_ENABLE
+    eeprom_write_behind_task();
+#endif
+
+#ifdef SEND_STRING_QUEUE_SIZE
+    send_string_task();
+#endif
 
 #ifdef DEBUG_MATRIX_SCAN_RATE
     matrix_scan_perf_task();
@@ -491,7 +732,10 @@ MATRIX_LOOP_END:
 #endif
 
 #ifdef POINTING_DEVICE_ENABLE
-    pointing_device_task();
+#    ifdef DEFERRED_INIT_ENABLE
+    if (deferred_init_done)
+#    endif
+        pointing_device_task();
 #endif
 
 #ifdef MIDI_ENABLE
@@ -521,6 +765,16 @@ MATRIX_LOOP_END:
         led_status = host_keyboard_leds();
         keyboard_set_leds(led_status);
     }
+
+#if defined(BOOT_TIMELINE_ENABLE) || defined(DEFERRED_INIT_ENABLE)
+    if (!first_scan_done) {
+        first_scan_done = true;
+        boot_timeline_record("first scan", task_start);
+#    ifndef DEFERRED_INIT_ENABLE
+        if (debug_enable) boot_timeline_print();
+#    endif
+    }
+#endif
 }
 
 /** \brief keyboard set leds
@@ -84,6 +84,33 @@ uint32_t last_encoder_activity_time(void);     // Timestamp of the last encoder
 uint32_t last_encoder_activity_elapsed(void);  // Number of milliseconds since the last encoder activity
 
 uint32_t get_matrix_scan_rate(void);
+#ifdef MATRIX_WAKE_ENABLE
+uint8_t get_matrix_idle_ratio(void);  // Percentage of the last second matrix_scan() spent parked waiting for a key edge
+#endif
+
+#ifdef BOOT_TIMELINE_ENABLE
+/* one timed step of startup */
+typedef struct {
+    const char *name;
+    uint32_t    start;     // Milliseconds from the start of keyboard_init()
+    uint32_t    duration;  // Milliseconds the step took
+} boot_timeline_entry_t;
+
+uint8_t                      boot_timeline_count(void);         // Number of steps recorded so far
+const boot_timeline_entry_t *boot_timeline_get(uint8_t index);  // Step by index, in the order they ran, or NULL
+void                         boot_timeline_print(void);         // Print the steps recorded so far to the console
+#endif
+
+#ifdef DEFERRED_INIT_ENABLE
+bool keyboard_deferred_init_done(void);  // Whether the deferred peripherals have been brought up
+void keyboard_deferred_init_kb(void);
+void keyboard_deferred_init_user(void);
+#endif
+
+#ifdef KEY_EVENT_QUEUE_SIZE
+uint8_t key_event_queue_last_count(void);       // Number of key events queued by the last matrix scan
+uint8_t key_event_queue_high_water_mark(void);  // Largest number of key events queued by a single matrix scan
+#endif
 
 #ifdef __cplusplus
 }
@@ -107,6 +107,16 @@ static led_task_states led_task_state    = SYNCING;
 static uint32_t led_anykey_timer;
 #endif  // LED_DISABLE_TIMEOUT > 0
 
+#ifdef LED_MATRIX_RENDER_BUDGET_US
+// render budget, with the cost of one LED in 1/16 us, zero until it has been measured
+static uint32_t                  led_render_led_cost = 0;
+static uint8_t                   led_render_slice    = LED_MATRIX_LED_PROCESS_LIMIT < LED_MATRIX_RENDER_SLICE_MAX ? LED_MATRIX_LED_PROCESS_LIMIT : LED_MATRIX_RENDER_SLICE_MAX;
+static uint16_t                  led_render_frames   = 0;
+static uint16_t                  led_render_worst    = 0;
+static uint32_t                  led_render_stats_timer;
+static led_matrix_render_stats_t led_render_stats;
+#endif  // LED_MATRIX_RENDER_BUDGET_US
+
 // double buffers
 static uint32_t led_timer_buffer;
 #ifdef LED_MATRIX_KEYREACTIVE_ENABLED
@@ -259,6 +269,36 @@ static void led_task_timers(void) {
 #endif  // LED_MATRIX_KEYREACTIVE_ENABLED
 }
 
+#ifdef LED_MATRIX_RENDER_BUDGET_US
+#    ifdef TIMER_US_SUPPORTED
+#        define led_render_clock() timer_read_us()
+#    else
+// Slices cannot be timed finer than a millisecond here, so they stay at LED_MATRIX_LED_PROCESS_LIMIT and are only timed for the stats
+#        define led_render_clock() (timer_read32() * 1000)
+#    endif
+
+static void led_task_measure(uint8_t leds, uint32_t elapsed_us) {
+    if (elapsed_us > led_render_worst) led_render_worst = elapsed_us > UINT16_MAX ? UINT16_MAX : elapsed_us;
+#    ifdef TIMER_US_SUPPORTED
+    if (!leds) return;
+
+    int32_t sample = elapsed_us * 16 / leds;
+    if (led_render_led_cost == 0) {
+        led_render_led_cost = sample;
+    } else {
+        led_render_led_cost += (sample - (int32_t)led_render_led_cost) / 8;
+    }
+
+    uint32_t slice = led_render_led_cost ? (uint32_t)LED_MATRIX_RENDER_BUDGET_US * 16 / led_render_led_cost : LED_MATRIX_RENDER_SLICE_MAX;
+    if (slice < 1) slice = 1;
+    if (slice > LED_MATRIX_RENDER_SLICE_MAX) slice = LED_MATRIX_RENDER_SLICE_MAX;
+    led_render_slice = slice;
+#    endif
+}
+
+led_matrix_render_stats_t led_matrix_get_render_stats(void) { return led_render_stats; }
+#endif  // LED_MATRIX_RENDER_BUDGET_US
+
 static void led_task_sync(void) {
     eeconfig_flush_led_matrix(false);
     // next task
@@ -287,6 +327,14 @@ static void led_task_render(uint8_t effect) {
         led_matrix_set_value_all(0);
     }
 
+#ifdef LED_MATRIX_RENDER_BUDGET_US
+    // pick up where the last iteration of this frame stopped, with as many LEDs as fit the budget
+    uint32_t render_start     = led_render_clock();
+    led_effect_params.led_min = led_effect_params.iter ? led_effect_params.led_max : 0;
+    led_effect_params.led_max = led_effect_params.led_min + led_render_slice;
+    if (led_effect_params.led_max > DRIVER_LED_TOTAL || led_effect_params.led_max < led_effect_params.led_min) led_effect_params.led_max = DRIVER_LED_TOTAL;
+#endif  // LED_MATRIX_RENDER_BUDGET_US
+
     // each effect can opt to do calculations
     // and/or request PWM buffer updates.
     switch (effect) {
@@ -320,6 +368,10 @@ static void led_task_render(uint8_t effect) {
             // ---------------------------------------------
     }
 
+#ifdef LED_MATRIX_RENDER_BUDGET_US
+    led_task_measure(led_effect_params.led_max - led_effect_params.led_min, TIMER_DIFF_32(led_render_clock(), render_start));
+#endif  // LED_MATRIX_RENDER_BUDGET_US
+
     led_effect_params.iter++;
 
     // next task
@@ -340,6 +392,20 @@ static void led_task_flush(uint8_t effect) {
     // update pwm buffers
     led_matrix_update_pwm_buffers();
 
+#ifdef LED_MATRIX_RENDER_BUDGET_US
+    led_render_frames++;
+    uint32_t stats_elapsed = timer_elapsed32(led_render_stats_timer);
+    if (stats_elapsed >= 1000) {
+        led_render_stats.fps            = (uint32_t)led_render_frames * 1000 / stats_elapsed;
+        led_render_stats.worst_slice_us = led_render_worst;
+        led_render_stats.slice_leds     = led_render_slice;
+        dprintf("led matrix render: %u fps, %u LEDs per slice, worst slice %u us\n", led_render_stats.fps, led_render_stats.slice_leds, led_render_stats.worst_slice_us);
+        led_render_frames      = 0;
+        led_render_worst       = 0;
+        led_render_stats_timer = timer_read32();
+    }
+#endif  // LED_MATRIX_RENDER_BUDGET_US
+
     // next task
     led_task_state = SYNCING;
 }
@@ -392,7 +458,10 @@ void led_matrix_indicators_advanced(effect_params_t *params) {
      * and not sure which would be better. Otherwise, this should be called from
      * led_task_render, right before the iter++ line.
      */
-#if defined(LED_MATRIX_LED_PROCESS_LIMIT) && LED_MATRIX_LED_PROCESS_LIMIT > 0 && LED_MATRIX_LED_PROCESS_LIMIT < DRIVER_LED_TOTAL
+#if defined(LED_MATRIX_RENDER_BUDGET_US)
+    uint8_t min = params->led_min;
+    uint8_t max = params->led_max;
+#elif defined(LED_MATRIX_LED_PROCESS_LIMIT) && LED_MATRIX_LED_PROCESS_LIMIT > 0 && LED_MATRIX_LED_PROCESS_LIMIT < DRIVER_LED_TOTAL
     uint8_t min = LED_MATRIX_LED_PROCESS_LIMIT * (params->iter - 1);
     uint8_t max = min + LED_MATRIX_LED_PROCESS_LIMIT;
     if (max > DRIVER_LED_TOTAL) max = DRIVER_LED_TOTAL;
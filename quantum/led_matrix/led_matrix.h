@@ -36,7 +36,24 @@
 #    define LED_MATRIX_LED_PROCESS_LIMIT (DRIVER_LED_TOTAL + 4) / 5
 #endif
 
-#if defined(LED_MATRIX_LED_PROCESS_LIMIT) && LED_MATRIX_LED_PROCESS_LIMIT > 0 && LED_MATRIX_LED_PROCESS_LIMIT < DRIVER_LED_TOTAL
+#ifndef LED_MATRIX_RENDER_SLICE_MAX
+#    define LED_MATRIX_RENDER_SLICE_MAX DRIVER_LED_TOTAL
+#endif
+
+#if defined(LED_MATRIX_RENDER_BUDGET_US)
+#    if defined(LED_MATRIX_SPLIT)
+#        define LED_MATRIX_USE_LIMITS(min, max)                                                   \
+            uint8_t min                   = params->led_min;                                      \
+            uint8_t max                   = params->led_max;                                      \
+            uint8_t k_led_matrix_split[2] = LED_MATRIX_SPLIT;                                     \
+            if (is_keyboard_left() && (max > k_led_matrix_split[0])) max = k_led_matrix_split[0]; \
+            if (!(is_keyboard_left()) && (min < k_led_matrix_split[0])) min = k_led_matrix_split[0];
+#    else
+#        define LED_MATRIX_USE_LIMITS(min, max) \
+            uint8_t min = params->led_min;      \
+            uint8_t max = params->led_max;
+#    endif
+#elif defined(LED_MATRIX_LED_PROCESS_LIMIT) && LED_MATRIX_LED_PROCESS_LIMIT > 0 && LED_MATRIX_LED_PROCESS_LIMIT < DRIVER_LED_TOTAL
 #    if defined(LED_MATRIX_SPLIT)
 #        define LED_MATRIX_USE_LIMITS(min, max)                                                   \
             uint8_t min = LED_MATRIX_LED_PROCESS_LIMIT * params->iter;                            \
@@ -118,6 +135,10 @@ void led_matrix_indicators_advanced(effect_params_t *params);
 void led_matrix_indicators_advanced_kb(uint8_t led_min, uint8_t led_max);
 void led_matrix_indicators_advanced_user(uint8_t led_min, uint8_t led_max);
 
+#ifdef LED_MATRIX_RENDER_BUDGET_US
+led_matrix_render_stats_t led_matrix_get_render_stats(void);
+#endif
+
 void led_matrix_init(void);
 
 void        led_matrix_set_suspend_state(bool state);
@@ -56,8 +56,19 @@ typedef struct PACKED {
     uint8_t     iter;
     led_flags_t flags;
     bool        init;
+#ifdef LED_MATRIX_RENDER_BUDGET_US
+    // LEDs to render in this iteration, from led_min up to but not including led_max
+    uint8_t led_min;
+    uint8_t led_max;
+#endif
 } effect_params_t;
 
+typedef struct PACKED {
+    uint16_t fps;             // Frames sent to the driver over the last second
+    uint16_t worst_slice_us;  // Longest single render iteration over the last second
+    uint8_t  slice_leds;      // LEDs currently rendered per iteration
+} led_matrix_render_stats_t;
+
 typedef struct PACKED {
     uint8_t x;
     uint8_t y;
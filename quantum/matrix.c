@@ -30,6 +30,16 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #    define ROWS_PER_HAND (MATRIX_ROWS)
 #endif
 
+#ifdef MATRIX_WAKE_ENABLE
+#    ifdef SPLIT_KEYBOARD
+#        error "MATRIX_WAKE_ENABLE is not supported on split keyboards"
+#    endif
+#    include "matrix_wake.h"
+#    ifndef MATRIX_WAKE_TIMEOUT
+#        define MATRIX_WAKE_TIMEOUT 10
+#    endif
+#endif
+
 #ifdef DIRECT_PINS_RIGHT
 #    define SPLIT_MUTABLE
 #else
@@ -129,6 +139,36 @@ __attribute__((weak)) void matrix_read_cols_on_row(matrix_row_t current_matrix[]
 #    if defined(MATRIX_ROW_PINS) && defined(MATRIX_COL_PINS)
 #        if (DIODE_DIRECTION == COL2ROW)
 
+#            ifdef MATRIX_COL_PORT_MAP
+#                ifdef MATRIX_COL_PINS_RIGHT
+#                    error "MATRIX_COL_PORT_MAP cannot be used with MATRIX_COL_PINS_RIGHT"
+#                endif
+/* A run of columns wired to the same port, with column n on port bit (n + shift) */
+typedef struct {
+    pin_t    port;  // any pin on the port, the same pin for every segment of a port
+    uint32_t mask;  // port bits belonging to this segment
+    int8_t   shift;
+} matrix_port_segment_t;
+
+static const matrix_port_segment_t col_port_map[] = MATRIX_COL_PORT_MAP;
+
+static matrix_row_t read_cols_by_port(void) {
+    matrix_row_t row_value  = 0;
+    uint32_t     port_value = 0;
+
+    for (uint8_t i = 0; i < sizeof(col_port_map) / sizeof(col_port_map[0]); i++) {
+        const matrix_port_segment_t *segment = &col_port_map[i];
+        // Segments of the same port are adjacent, so each port is only read once per row
+        if (i == 0 || segment->port != col_port_map[i - 1].port) {
+            port_value = ~(uint32_t)readPort(segment->port);
+        }
+        uint32_t bits = port_value & segment->mask;
+        row_value |= (matrix_row_t)(segment->shift >= 0 ? bits >> segment->shift : bits << -segment->shift);
+    }
+    return row_value;
+}
+#            endif
+
 static bool select_row(uint8_t row) {
     pin_t pin = row_pins[row];
     if (pin != NO_PIN) {
@@ -169,6 +209,9 @@ __attribute__((weak)) void matrix_read_cols_on_row(matrix_row_t current_matrix[]
     }
     matrix_output_select_delay();
 
+#            ifdef MATRIX_COL_PORT_MAP
+    current_row_value = read_cols_by_port();
+#            else
     // For each col...
     matrix_row_t row_shifter = MATRIX_ROW_SHIFTER;
     for (uint8_t col_index = 0; col_index < MATRIX_COLS; col_index++, row_shifter <<= 1) {
@@ -177,6 +220,7 @@ __attribute__((weak)) void matrix_read_cols_on_row(matrix_row_t current_matrix[]
         // Populate the matrix row with the state of the col pin
         current_row_value |= pin_state ? 0 : row_shifter;
     }
+#            endif
 
     // Unselect row
     unselect_row(current_row);
@@ -254,6 +298,45 @@ __attribute__((weak)) void matrix_read_rows_on_col(matrix_row_t current_matrix[]
 #    error DIODE_DIRECTION is not defined!
 #endif
 
+#ifdef MATRIX_WAKE_ENABLE
+static uint32_t matrix_idle_ms = 0;
+
+uint32_t matrix_idle_time(void) { return matrix_idle_ms; }
+
+static bool matrix_is_idle(void) {
+    for (uint8_t row = 0; row < ROWS_PER_HAND; row++) {
+        if (raw_matrix[row] || matrix[row]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void matrix_wait_for_change(void) {
+    uint32_t idle_start = timer_read32();
+#    if defined(DIRECT_PINS)
+    matrix_wake_wait(&direct_pins[0][0], MATRIX_ROWS * MATRIX_COLS, MATRIX_WAKE_TIMEOUT);
+#    elif (DIODE_DIRECTION == COL2ROW)
+    // Drive every row at once so that any key press pulls its column low
+    for (uint8_t row = 0; row < ROWS_PER_HAND; row++) {
+        select_row(row);
+    }
+    matrix_output_select_delay();
+    matrix_wake_wait(col_pins, MATRIX_COLS, MATRIX_WAKE_TIMEOUT);
+    unselect_rows();
+#    elif (DIODE_DIRECTION == ROW2COL)
+    // Drive every column at once so that any key press pulls its row low
+    for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+        select_col(col);
+    }
+    matrix_output_select_delay();
+    matrix_wake_wait(row_pins, ROWS_PER_HAND, MATRIX_WAKE_TIMEOUT);
+    unselect_cols();
+#    endif
+    matrix_idle_ms += timer_elapsed32(idle_start);
+}
+#endif
+
 void matrix_init(void) {
 #ifdef SPLIT_KEYBOARD
     split_pre_init();
@@ -365,5 +448,12 @@ uint8_t matrix_scan(void) {
     debounce(raw_matrix, matrix, ROWS_PER_HAND, changed);
     matrix_scan_quantum();
 #endif
+
+#ifdef MATRIX_WAKE_ENABLE
+    // Nothing held and nothing left for debounce to commit, so sleep until an edge instead of rescanning
+    if (!changed && matrix_is_idle()) {
+        matrix_wait_for_change();
+    }
+#endif
     return (uint8_t)changed;
 }
@@ -79,6 +79,11 @@ void matrix_slave_scan_kb(void);
 void matrix_slave_scan_user(void);
 #endif
 
+#ifdef MATRIX_WAKE_ENABLE
+/* total milliseconds matrix_scan() has spent parked waiting for a key edge */
+uint32_t matrix_idle_time(void);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -458,7 +458,15 @@ void mousekey_send(void) {
     uint16_t time = timer_read();
     if (mouse_report.x || mouse_report.y) last_timer_c = time;
     if (mouse_report.v || mouse_report.h) last_timer_w = time;
+#ifdef POINTING_DEVICE_HIRES_SCROLL_ENABLE
+    // Wheel keys scroll by whole notches, whatever resolution the host asked for
+    report_mouse_t report = mouse_report;
+    report.v *= host_mouse_scroll_resolution();
+    report.h *= host_mouse_scroll_resolution();
+    host_mouse_send(&report);
+#else
     host_mouse_send(&mouse_report);
+#endif
 }
 
 void mousekey_clear(void) {
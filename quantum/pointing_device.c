@@ -21,15 +21,24 @@
 #ifdef MOUSEKEY_ENABLE
 #    include "mousekey.h"
 #endif
+#ifdef POINTING_DEVICE_MOTION_IRQ_ENABLE
+#    include "pointing_device_motion.h"
+#    ifndef POINTING_DEVICE_MOTION_PIN
+#        error "POINTING_DEVICE_MOTION_IRQ_ENABLE requires POINTING_DEVICE_MOTION_PIN"
+#    endif
+#endif
 #if (defined(POINTING_DEVICE_ROTATION_90) + defined(POINTING_DEVICE_ROTATION_180) + defined(POINTING_DEVICE_ROTATION_270)) > 1
 #    error More than one rotation selected.  This is not supported.
 #endif
 
 static report_mouse_t mouseReport = {};
 
+// Movement left over from reports that could not carry all of it, or that the host was not ready for
+static int32_t motion_carry_x = 0, motion_carry_y = 0, motion_carry_v = 0, motion_carry_h = 0;
+
 extern const pointing_device_driver_t pointing_device_driver;
 
-__attribute__((weak)) bool has_mouse_report_changed(report_mouse_t new, report_mouse_t old) { return memcmp(&new, &old, sizeof(new)); }
+__attribute__((weak)) bool has_mouse_report_changed(report_mouse_t new_report, report_mouse_t old_report) { return memcmp(&new_report, &old_report, sizeof(new_report)); }
 
 __attribute__((weak)) void           pointing_device_init_kb(void) {}
 __attribute__((weak)) void           pointing_device_init_user(void) {}
@@ -49,13 +58,46 @@ __attribute__((weak)) void pointing_device_init(void) {
     pointing_device_driver.init();
 #ifdef POINTING_DEVICE_MOTION_PIN
     setPinInputHigh(POINTING_DEVICE_MOTION_PIN);
+#    ifdef POINTING_DEVICE_MOTION_IRQ_ENABLE
+    pointing_device_motion_irq_init(POINTING_DEVICE_MOTION_PIN);
+#    endif
 #endif
     pointing_device_init_kb();
     pointing_device_init_user();
 }
 
+static int32_t take_motion(int32_t *carry, int32_t delta, int32_t limit) {
+    int32_t total = *carry + delta;
+    int32_t part  = total < -limit ? -limit : (total > limit ? limit : total);
+    *carry        = total - part;
+    return part;
+}
+
 __attribute__((weak)) void pointing_device_send(void) {
     static report_mouse_t old_report = {};
+    int32_t               limit      = MOUSE_REPORT_XY_MAX;
+
+    if (!host_mouse_ready()) {
+        // The host has not collected the last report yet, so hold on to this one rather than wait for it; buttons stay set until then
+        motion_carry_x += mouseReport.x;
+        motion_carry_y += mouseReport.y;
+        motion_carry_v += mouseReport.v;
+        motion_carry_h += mouseReport.h;
+        mouseReport.x = 0;
+        mouseReport.y = 0;
+        mouseReport.v = 0;
+        mouseReport.h = 0;
+        return;
+    }
+
+#ifdef MOUSE_EXTENDED_REPORT
+    // Boot protocol hosts only see the 8-bit copy of X/Y, so large movements go out over several reports
+    if (!mouse_protocol) limit = 127;
+#endif
+    mouseReport.x = take_motion(&motion_carry_x, mouseReport.x, limit);
+    mouseReport.y = take_motion(&motion_carry_y, mouseReport.y, limit);
+    mouseReport.v = take_motion(&motion_carry_v, mouseReport.v, MOUSE_REPORT_HV_MAX);
+    mouseReport.h = take_motion(&motion_carry_h, mouseReport.h, MOUSE_REPORT_HV_MAX);
 
     // If you need to do other things, like debugging, this is the place to do it.
     if (has_mouse_report_changed(mouseReport, old_report)) {
@@ -71,15 +113,21 @@ __attribute__((weak)) void pointing_device_send(void) {
 }
 
 __attribute__((weak)) void pointing_device_task(void) {
+    // The sensor keeps counting while the host is busy, so read it once the host can take the report
+    if (!host_mouse_ready()) return;
+
     // Gather report info
-#ifdef POINTING_DEVICE_MOTION_PIN
+#if defined(POINTING_DEVICE_MOTION_IRQ_ENABLE)
+    // A short pulse may be over by now, but the edge was latched; the level covers motion from before the edge was armed
+    if (pointing_device_motion_irq_take() || !readPin(POINTING_DEVICE_MOTION_PIN))
+#elif defined(POINTING_DEVICE_MOTION_PIN)
     if (!readPin(POINTING_DEVICE_MOTION_PIN))
 #endif
         mouseReport = pointing_device_driver.get_report(mouseReport);
 
         // Support rotation of the sensor data
 #if defined(POINTING_DEVICE_ROTATION_90) || defined(POINTING_DEVICE_ROTATION_180) || defined(POINTING_DEVICE_ROTATION_270)
-    int8_t x = mouseReport.x, y = mouseReport.y;
+    mouse_xy_report_t x = mouseReport.x, y = mouseReport.y;
 #    if defined(POINTING_DEVICE_ROTATION_90)
     mouseReport.x = y;
     mouseReport.y = -x;
@@ -100,6 +148,9 @@ __attribute__((weak)) void pointing_device_task(void) {
 #if defined(POINTING_DEVICE_INVERT_Y)
     mouseReport.y = -mouseReport.y;
 #endif
+#ifdef POINTING_DEVICE_ACCEL_ENABLE
+    mouseReport = pointing_device_accel_task(mouseReport);
+#endif
 
     // allow kb to intercept and modify report
     mouseReport = pointing_device_task_kb(mouseReport);
@@ -20,6 +20,9 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include <stdint.h>
 #include "host.h"
 #include "report.h"
+#ifdef POINTING_DEVICE_ACCEL_ENABLE
+#    include "pointing_device_accel.h"
+#endif
 
 #if defined(POINTING_DEVICE_DRIVER_adns5050)
 #    include "drivers/sensors/adns5050.h"
@@ -72,12 +75,15 @@ typedef enum {
     POINTING_DEVICE_BUTTON8,
 } pointing_device_buttons_t;
 
+// Sensor deltas are 16-bit, so they only lose anything to this when the report's X and Y are 8-bit
+#define constrain_hid_xy(amt) ((amt) < -MOUSE_REPORT_XY_MAX ? -MOUSE_REPORT_XY_MAX : ((amt) > MOUSE_REPORT_XY_MAX ? MOUSE_REPORT_XY_MAX : (amt)))
+
 void           pointing_device_init(void);
 void           pointing_device_task(void);
 void           pointing_device_send(void);
 report_mouse_t pointing_device_get_report(void);
 void           pointing_device_set_report(report_mouse_t newMouseReport);
-bool           has_mouse_report_changed(report_mouse_t new, report_mouse_t old);
+bool           has_mouse_report_changed(report_mouse_t new_report, report_mouse_t old_report);
 uint16_t       pointing_device_get_cpi(void);
 void           pointing_device_set_cpi(uint16_t cpi);
 
@@ -0,0 +1,148 @@
+/* Copyright 2022 QMK
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "pointing_device_accel.h"
+#include "host.h"
+#include "timer.h"
+
+#if POINTING_DEVICE_ACCEL_SMOOTHING < 0 || POINTING_DEVICE_ACCEL_SMOOTHING > 255
+#    error POINTING_DEVICE_ACCEL_SMOOTHING must be between 0 and 255
+#endif
+
+#define ACCEL_LIMIT(value, limit) ((value) < -(limit) ? -(limit) : ((value) > (limit) ? (limit) : (value)))
+
+// Largest movement, in counts times 256, that is processed in one go
+#define ACCEL_INPUT_MAX (1L << 22)
+
+static const uint16_t accel_curve[POINTING_DEVICE_ACCEL_CURVE_POINTS] = POINTING_DEVICE_ACCEL_CURVE;
+
+static bool     accel_enabled = true;
+static bool     drag_scroll   = false;
+static uint16_t accel_scale   = POINTING_DEVICE_ACCEL_SCALE;
+static uint16_t last_tick     = 0;
+
+// Sensor counts not processed yet
+static int32_t pending_x = 0, pending_y = 0;
+// Smoothed movement of the last ms, in counts times 256
+static int32_t smooth_x = 0, smooth_y = 0;
+// Processed movement not sent yet, in counts times 256
+static int32_t output_x = 0, output_y = 0, output_v = 0, output_h = 0;
+
+static uint16_t accel_gain(uint32_t speed) {
+    uint32_t position = speed / POINTING_DEVICE_ACCEL_SPEED_STEP;
+
+    if (position >= (POINTING_DEVICE_ACCEL_CURVE_POINTS - 1) << 8) {
+        return accel_curve[POINTING_DEVICE_ACCEL_CURVE_POINTS - 1];
+    }
+    uint8_t index    = position >> 8;
+    int32_t fraction = position & 0xFF;
+    return accel_curve[index] + ((int32_t)accel_curve[index + 1] - accel_curve[index]) * fraction / 256;
+}
+
+static int32_t accel_smooth(int32_t previous, int32_t input) {
+#if POINTING_DEVICE_ACCEL_SMOOTHING > 0
+    return input + (previous - input) * POINTING_DEVICE_ACCEL_SMOOTHING / 256;
+#else
+    return input;
+#endif
+}
+
+static int32_t accel_apply_gain(int32_t movement, uint16_t gain) {
+    // Split in whole and fractional counts, so neither product overflows
+    return movement / 256 * gain + movement % 256 * gain / 256;
+}
+
+static int32_t accel_take(int32_t *output, int32_t limit) {
+    int32_t part = ACCEL_LIMIT(*output / 256, limit);
+    *output -= part * 256;
+    return part;
+}
+
+static void accel_process(uint16_t elapsed) {
+    int32_t in_x = ACCEL_LIMIT(pending_x, 4096), in_y = ACCEL_LIMIT(pending_y, 4096);
+
+    pending_x -= in_x;
+    pending_y -= in_y;
+
+    // Scaling brings sensors of any CPI to the same speeds on the curve
+    smooth_x = accel_smooth(smooth_x, ACCEL_LIMIT(in_x * accel_scale, ACCEL_INPUT_MAX));
+    smooth_y = accel_smooth(smooth_y, ACCEL_LIMIT(in_y * accel_scale, ACCEL_INPUT_MAX));
+
+    if (drag_scroll) {
+        int32_t resolution = host_mouse_scroll_resolution();
+
+        output_h += smooth_x * resolution / POINTING_DEVICE_DRAG_SCROLL_DIVISOR;
+        output_v -= smooth_y * resolution / POINTING_DEVICE_DRAG_SCROLL_DIVISOR;
+        return;
+    }
+
+    uint16_t gain = 256;
+    if (accel_enabled) {
+        // Approximates the length of the movement without a square root
+        uint32_t abs_x  = smooth_x < 0 ? -smooth_x : smooth_x, abs_y = smooth_y < 0 ? -smooth_y : smooth_y;
+        uint32_t length = abs_x > abs_y ? abs_x + abs_y * 3 / 8 : abs_y + abs_x * 3 / 8;
+
+        gain = accel_gain(length / elapsed);
+    }
+    output_x += accel_apply_gain(smooth_x, gain);
+    output_y += accel_apply_gain(smooth_y, gain);
+}
+
+report_mouse_t pointing_device_accel_task(report_mouse_t mouse_report) {
+    uint16_t now     = timer_read();
+    uint16_t elapsed = TIMER_DIFF_16(now, last_tick);
+
+    pending_x += mouse_report.x;
+    pending_y += mouse_report.y;
+    output_v += (int32_t)mouse_report.v * 256;
+    output_h += (int32_t)mouse_report.h * 256;
+
+    // Movement is processed once per ms, so the curve and the smoothing do not depend on how often the sensor is read
+    if (elapsed > 0) {
+        last_tick = now;
+        accel_process(elapsed);
+    }
+
+    mouse_report.x = accel_take(&output_x, MOUSE_REPORT_XY_MAX);
+    mouse_report.y = accel_take(&output_y, MOUSE_REPORT_XY_MAX);
+    mouse_report.v = accel_take(&output_v, MOUSE_REPORT_HV_MAX);
+    mouse_report.h = accel_take(&output_h, MOUSE_REPORT_HV_MAX);
+    return mouse_report;
+}
+
+void pointing_device_accel_reset(void) {
+    pending_x = 0;
+    pending_y = 0;
+    smooth_x  = 0;
+    smooth_y  = 0;
+    output_x  = 0;
+    output_y  = 0;
+    output_v  = 0;
+    output_h  = 0;
+    last_tick = timer_read();
+}
+
+void pointing_device_accel_set_enabled(bool enable) { accel_enabled = enable; }
+
+bool pointing_device_accel_get_enabled(void) { return accel_enabled; }
+
+void pointing_device_accel_set_drag_scroll(bool enable) { drag_scroll = enable; }
+
+bool pointing_device_accel_get_drag_scroll(void) { return drag_scroll; }
+
+void pointing_device_accel_set_scale(uint16_t scale) { accel_scale = scale; }
+
+uint16_t pointing_device_accel_get_scale(void) { return accel_scale; }
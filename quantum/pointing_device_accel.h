@@ -0,0 +1,84 @@
+/* Copyright 2022 QMK
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "report.h"
+
+/* All gains and scales are fixed point, with 256 meaning 1.0. */
+
+// Counts per ms between two points of the acceleration curve
+#ifndef POINTING_DEVICE_ACCEL_SPEED_STEP
+#    define POINTING_DEVICE_ACCEL_SPEED_STEP 2
+#endif
+
+// Speed, in counts per ms, up to which movement is not accelerated
+#ifndef POINTING_DEVICE_ACCEL_OFFSET
+#    define POINTING_DEVICE_ACCEL_OFFSET 2
+#endif
+
+// Gain added for every count per ms above the offset
+#ifndef POINTING_DEVICE_ACCEL_SLOPE
+#    define POINTING_DEVICE_ACCEL_SLOPE 32
+#endif
+
+// Highest gain, at most 4095
+#ifndef POINTING_DEVICE_ACCEL_LIMIT
+#    define POINTING_DEVICE_ACCEL_LIMIT 1024
+#endif
+
+// Share of the previous motion kept on each ms, from 0 (no smoothing) to 255
+#ifndef POINTING_DEVICE_ACCEL_SMOOTHING
+#    define POINTING_DEVICE_ACCEL_SMOOTHING 0
+#endif
+
+// Scale applied to sensor counts, before the curve
+#ifndef POINTING_DEVICE_ACCEL_SCALE
+#    define POINTING_DEVICE_ACCEL_SCALE 256
+#endif
+
+// Counts of movement for one unit of scrolling in drag scroll mode
+#ifndef POINTING_DEVICE_DRAG_SCROLL_DIVISOR
+#    define POINTING_DEVICE_DRAG_SCROLL_DIVISOR 8
+#endif
+
+#define POINTING_DEVICE_ACCEL_CURVE_POINTS 16
+
+#define POINTING_DEVICE_ACCEL_POINT(i) ((i) * POINTING_DEVICE_ACCEL_SPEED_STEP <= POINTING_DEVICE_ACCEL_OFFSET ? 256 : (256 + POINTING_DEVICE_ACCEL_SLOPE * ((i) * POINTING_DEVICE_ACCEL_SPEED_STEP - POINTING_DEVICE_ACCEL_OFFSET) > POINTING_DEVICE_ACCEL_LIMIT ? POINTING_DEVICE_ACCEL_LIMIT : 256 + POINTING_DEVICE_ACCEL_SLOPE * ((i) * POINTING_DEVICE_ACCEL_SPEED_STEP - POINTING_DEVICE_ACCEL_OFFSET)))
+
+// Gain at 0, 1, 2... times POINTING_DEVICE_ACCEL_SPEED_STEP counts per ms
+#ifndef POINTING_DEVICE_ACCEL_CURVE
+// clang-format off
+#    define POINTING_DEVICE_ACCEL_CURVE { \
+        POINTING_DEVICE_ACCEL_POINT(0),  POINTING_DEVICE_ACCEL_POINT(1),  POINTING_DEVICE_ACCEL_POINT(2),  POINTING_DEVICE_ACCEL_POINT(3),  \
+        POINTING_DEVICE_ACCEL_POINT(4),  POINTING_DEVICE_ACCEL_POINT(5),  POINTING_DEVICE_ACCEL_POINT(6),  POINTING_DEVICE_ACCEL_POINT(7),  \
+        POINTING_DEVICE_ACCEL_POINT(8),  POINTING_DEVICE_ACCEL_POINT(9),  POINTING_DEVICE_ACCEL_POINT(10), POINTING_DEVICE_ACCEL_POINT(11), \
+        POINTING_DEVICE_ACCEL_POINT(12), POINTING_DEVICE_ACCEL_POINT(13), POINTING_DEVICE_ACCEL_POINT(14), POINTING_DEVICE_ACCEL_POINT(15)  \
+    }
+// clang-format on
+#endif
+
+report_mouse_t pointing_device_accel_task(report_mouse_t mouse_report);
+void           pointing_device_accel_reset(void);
+
+void     pointing_device_accel_set_enabled(bool enable);
+bool     pointing_device_accel_get_enabled(void);
+void     pointing_device_accel_set_drag_scroll(bool enable);
+bool     pointing_device_accel_get_drag_scroll(void);
+void     pointing_device_accel_set_scale(uint16_t scale);
+uint16_t pointing_device_accel_get_scale(void);
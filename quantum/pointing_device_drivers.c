@@ -22,9 +22,6 @@
 #include "timer.h"
 #include <stddef.h>
 
-// hid mouse reports cannot exceed -127 to 127, so constrain to that value
-#define constrain_hid(amt) ((amt) < -127 ? -127 : ((amt) > 127 ? 127 : (amt)))
-
 // get_report functions should probably be moved to their respective drivers.
 #if defined(POINTING_DEVICE_DRIVER_adns5050)
 report_mouse_t adns5050_get_report(report_mouse_t mouse_report) {
@@ -55,11 +52,8 @@ const pointing_device_driver_t pointing_device_driver = {
 report_mouse_t adns9800_get_report_driver(report_mouse_t mouse_report) {
     report_adns9800_t sensor_report = adns9800_get_report();
 
-    int8_t clamped_x = constrain_hid(sensor_report.x);
-    int8_t clamped_y = constrain_hid(sensor_report.y);
-
-    mouse_report.x = clamped_x;
-    mouse_report.y = clamped_y;
+    mouse_report.x = constrain_hid_xy(sensor_report.x);
+    mouse_report.y = constrain_hid_xy(sensor_report.y);
 
     return mouse_report;
 }
@@ -117,14 +111,14 @@ const pointing_device_driver_t pointing_device_driver = {
 report_mouse_t cirque_pinnacle_get_report(report_mouse_t mouse_report) {
     pinnacle_data_t touchData = cirque_pinnacle_read_data();
     static uint16_t x = 0, y = 0, mouse_timer = 0;
-    int8_t          report_x = 0, report_y = 0;
+    int16_t         report_x = 0, report_y = 0;
     static bool     is_z_down = false;
 
     cirque_pinnacle_scale_data(&touchData, cirque_pinnacle_get_scale(), cirque_pinnacle_get_scale());  // Scale coordinates to arbitrary X, Y resolution
 
     if (x && y && touchData.xValue && touchData.yValue) {
-        report_x = (int8_t)(touchData.xValue - x);
-        report_y = (int8_t)(touchData.yValue - y);
+        report_x = (int16_t)(touchData.xValue - x);
+        report_y = (int16_t)(touchData.yValue - y);
     }
     x = touchData.xValue;
     y = touchData.yValue;
@@ -149,8 +143,8 @@ report_mouse_t cirque_pinnacle_get_report(report_mouse_t mouse_report) {
     if (timer_elapsed(mouse_timer) > (CIRQUE_PINNACLE_TOUCH_DEBOUNCE)) {
         mouse_timer = 0;
     }
-    mouse_report.x = report_x;
-    mouse_report.y = report_y;
+    mouse_report.x = constrain_hid_xy(report_x);
+    mouse_report.y = constrain_hid_xy(report_y);
 
     return mouse_report;
 }
@@ -215,6 +209,7 @@ static void init(void) { pmw3360_init(); }
 report_mouse_t pmw3360_get_report(report_mouse_t mouse_report) {
     report_pmw3360_t data        = pmw3360_read_burst();
     static uint16_t  MotionStart = 0;  // Timer for accel, 0 is resting state
+    int16_t          dx = 0, dy = 0;
 
     if (data.isOnSurface && data.isMotion) {
         // Reset timer if stopped moving
@@ -230,10 +225,13 @@ report_mouse_t pmw3360_get_report(report_mouse_t mouse_report) {
 #    endif
             MotionStart = timer_read();
         }
-        mouse_report.x = constrain_hid(data.dx);
-        mouse_report.y = constrain_hid(data.dy);
+        dx = data.dx;
+        dy = data.dy;
     }
 
+    mouse_report.x = constrain_hid_xy(dx);
+    mouse_report.y = constrain_hid_xy(dy);
+
     return mouse_report;
 }
 
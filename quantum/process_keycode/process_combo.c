@@ -14,6 +14,7 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <string.h>
 #include "print.h"
 #include "process_combo.h"
 #include "action_tapping.h"
@@ -67,6 +68,33 @@ static queued_combo_t combo_buffer[COMBO_BUFFER_LENGTH];
 
 #define INCREMENT_MOD(i) i = (i + 1) % COMBO_BUFFER_LENGTH
 
+#ifdef COMBO_KEY_INDEX_SIZE
+/* Reverse index from keycode to the combos that contain it, sorted by
+ * keycode and then by combo index. process_combo() then only visits the
+ * combos containing the pressed keycode, in the same order as a full scan,
+ * with each key's position and the combo's length already known. */
+typedef struct {
+    uint16_t keycode;
+    uint16_t combo_index;
+    uint8_t  key_index;
+    uint8_t  key_count;
+} combo_key_t;
+static combo_key_t combo_key_index[COMBO_KEY_INDEX_SIZE];
+static uint16_t    combo_key_index_size      = 0;
+static uint16_t    combo_key_index_combo_len = 0;
+static bool        combo_key_index_valid     = false;
+/* Set whenever a combo's state may have changed since clear_combos() */
+static bool combos_dirty = false;
+#endif
+
+#ifdef COMBO_VISIT_COUNTER
+/* Combos process_combo() has checked a key against, so tests can count what the key index saves */
+uint32_t combo_visits = 0;
+#    define COUNT_COMBO_VISIT() combo_visits++
+#else
+#    define COUNT_COMBO_VISIT()
+#endif
+
 #define COMBO_KEY_POS ((keypos_t){.col = 254, .row = 254})
 
 #ifndef EXTRA_SHORT_COMBOS
@@ -174,6 +202,12 @@ static inline uint16_t _get_combo_term(uint16_t combo_index, combo_t *combo) {
 void clear_combos(void) {
     uint16_t index = 0;
     longest_term   = 0;
+#ifdef COMBO_KEY_INDEX_SIZE
+    if (!combos_dirty) {
+        return;
+    }
+    combos_dirty = false;
+#endif
     for (index = 0; index < COMBO_LEN; ++index) {
         combo_t *combo = &key_combos[index];
         if (!COMBO_ACTIVE(combo)) {
@@ -237,6 +271,90 @@ static inline void _find_key_index_and_count(const uint16_t *keys, uint16_t keyc
     }
 }
 
+#ifdef COMBO_KEY_INDEX_SIZE
+static inline bool combo_key_less(const combo_key_t *a, const combo_key_t *b) { return a->keycode < b->keycode || (a->keycode == b->keycode && a->combo_index < b->combo_index); }
+
+static void sift_combo_key(uint16_t root, uint16_t size) {
+    combo_key_t entry = combo_key_index[root];
+    uint16_t    child;
+    while ((child = 2 * root + 1) < size) {
+        if (child + 1 < size && combo_key_less(&combo_key_index[child], &combo_key_index[child + 1])) {
+            child++;
+        }
+        if (!combo_key_less(&entry, &combo_key_index[child])) {
+            break;
+        }
+        combo_key_index[root] = combo_key_index[child];
+        root                  = child;
+    }
+    combo_key_index[root] = entry;
+}
+
+/* Heapsort, so building the index stays O(n log n) without recursion or extra memory */
+static void sort_combo_key_index(void) {
+    for (uint16_t i = combo_key_index_size / 2; i > 0; i--) {
+        sift_combo_key(i - 1, combo_key_index_size);
+    }
+    for (uint16_t end = combo_key_index_size; end > 1; end--) {
+        combo_key_t top          = combo_key_index[0];
+        combo_key_index[0]       = combo_key_index[end - 1];
+        combo_key_index[end - 1] = top;
+        sift_combo_key(0, end - 1);
+    }
+}
+
+static bool build_combo_key_index(void) {
+    combo_key_index_size = 0;
+    for (uint16_t combo_index = 0; combo_index < COMBO_LEN; ++combo_index) {
+        const uint16_t *keys      = key_combos[combo_index].keys;
+        uint16_t        first     = combo_key_index_size;
+        uint8_t         key_count = 0;
+        while (COMBO_END != pgm_read_word(&keys[key_count])) {
+            key_count++;
+        }
+
+        for (uint8_t key_index = 0; key_index < key_count; key_index++) {
+            uint16_t keycode = pgm_read_word(&keys[key_index]);
+            uint16_t pos     = first;
+            while (pos < combo_key_index_size && combo_key_index[pos].keycode != keycode) {
+                pos++;
+            }
+            if (pos < combo_key_index_size) {
+                /* Keycode repeated within a combo, the last one wins as in _find_key_index_and_count() */
+                combo_key_index[pos].key_index = key_index;
+                continue;
+            }
+            if (combo_key_index_size >= COMBO_KEY_INDEX_SIZE) {
+                dprintf("combo: COMBO_KEY_INDEX_SIZE %u too small, falling back to scanning all combos\n", COMBO_KEY_INDEX_SIZE);
+                return false;
+            }
+            combo_key_index[combo_key_index_size++] = (combo_key_t){
+                .keycode     = keycode,
+                .combo_index = combo_index,
+                .key_index   = key_index,
+                .key_count   = key_count,
+            };
+        }
+    }
+    sort_combo_key_index();
+    return true;
+}
+
+/* Returns the first index entry for keycode, or combo_key_index_size if there is none. */
+static uint16_t find_combo_key(uint16_t keycode) {
+    uint16_t low = 0, high = combo_key_index_size;
+    while (low < high) {
+        uint16_t mid = low + (high - low) / 2;
+        if (combo_key_index[mid].keycode < keycode) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return low;
+}
+#endif
+
 void drop_combo_from_buffer(uint16_t combo_index) {
     /* Mark a combo as processed from the buffer. If the buffer is in the
      * beginning of the buffer, drop it.  */
@@ -264,6 +382,9 @@ void apply_combo(uint16_t combo_index, combo_t *combo) {
     if (COMBO_DISABLED(combo)) {
         return;
     }
+#ifdef COMBO_KEY_INDEX_SIZE
+    combos_dirty = true;
+#endif
 
     // state to check against so we find the last key of the combo from the buffer
 #if defined(EXTRA_EXTRA_LONG_COMBOS)
@@ -350,16 +471,10 @@ combo_t *overlaps(combo_t *combo1, combo_t *combo2) {
     return combo1;
 }
 
-static bool process_single_combo(combo_t *combo, uint16_t keycode, keyrecord_t *record, uint16_t combo_index) {
-    uint8_t  key_count = 0;
-    uint16_t key_index = -1;
-    _find_key_index_and_count(combo->keys, keycode, &key_index, &key_count);
-
-    /* Continue processing if key isn't part of current combo. */
-    if (-1 == (int16_t)key_index) {
-        return false;
-    }
-
+static bool process_combo_key(combo_t *combo, uint16_t keycode, keyrecord_t *record, uint16_t combo_index, uint16_t key_index, uint8_t key_count) {
+#ifdef COMBO_KEY_INDEX_SIZE
+    combos_dirty = true;
+#endif
     bool key_is_part_of_combo = !COMBO_DISABLED(combo) && is_combo_enabled();
 
     if (record->event.pressed && key_is_part_of_combo) {
@@ -463,6 +578,19 @@ static bool process_single_combo(combo_t *combo, uint16_t keycode, keyrecord_t *
     return key_is_part_of_combo;
 }
 
+static bool process_single_combo(combo_t *combo, uint16_t keycode, keyrecord_t *record, uint16_t combo_index) {
+    uint8_t  key_count = 0;
+    uint16_t key_index = -1;
+    _find_key_index_and_count(combo->keys, keycode, &key_index, &key_count);
+
+    /* Continue processing if key isn't part of current combo. */
+    if (-1 == (int16_t)key_index) {
+        return false;
+    }
+
+    return process_combo_key(combo, keycode, record, combo_index, key_index, key_count);
+}
+
 bool process_combo(uint16_t keycode, keyrecord_t *record) {
     bool is_combo_key          = false;
     bool no_combo_keys_pressed = true;
@@ -487,10 +615,22 @@ bool process_combo(uint16_t keycode, keyrecord_t *record) {
     keycode = keymap_key_to_keycode(COMBO_ONLY_FROM_LAYER, record->event.key);
 #endif
 
-    for (uint16_t idx = 0; idx < COMBO_LEN; ++idx) {
-        combo_t *combo = &key_combos[idx];
-        is_combo_key |= process_single_combo(combo, keycode, record, idx);
-        no_combo_keys_pressed = no_combo_keys_pressed && (NO_COMBO_KEYS_ARE_DOWN || COMBO_ACTIVE(combo) || COMBO_DISABLED(combo));
+#ifdef COMBO_KEY_INDEX_SIZE
+    if (combo_key_index_valid) {
+        for (uint16_t i = find_combo_key(keycode); i < combo_key_index_size && combo_key_index[i].keycode == keycode; ++i) {
+            combo_key_t *combo_key = &combo_key_index[i];
+            COUNT_COMBO_VISIT();
+            is_combo_key |= process_combo_key(&key_combos[combo_key->combo_index], keycode, record, combo_key->combo_index, combo_key->key_index, combo_key->key_count);
+        }
+    } else
+#endif
+    {
+        for (uint16_t idx = 0; idx < COMBO_LEN; ++idx) {
+            combo_t *combo = &key_combos[idx];
+            COUNT_COMBO_VISIT();
+            is_combo_key |= process_single_combo(combo, keycode, record, idx);
+            no_combo_keys_pressed = no_combo_keys_pressed && (NO_COMBO_KEYS_ARE_DOWN || COMBO_ACTIVE(combo) || COMBO_DISABLED(combo));
+        }
     }
 
     if (record->event.pressed && is_combo_key) {
@@ -528,7 +668,21 @@ bool process_combo(uint16_t keycode, keyrecord_t *record) {
     return !is_combo_key;
 }
 
+void combo_init(void) {
+#ifdef COMBO_KEY_INDEX_SIZE
+    combo_key_index_valid     = build_combo_key_index();
+    combo_key_index_combo_len = COMBO_LEN;
+#endif
+}
+
 void combo_task(void) {
+#ifdef COMBO_KEY_INDEX_SIZE
+    /* Keymaps may change COMBO_LEN after combo_init(), e.g. from keyboard_post_init_user() */
+    if (combo_key_index_combo_len != COMBO_LEN) {
+        combo_init();
+    }
+#endif
+
     if (!b_combo_enable) {
         return;
     }
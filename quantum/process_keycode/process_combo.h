@@ -71,6 +71,7 @@ typedef struct {
 /* check if keycode is only modifiers */
 #define KEYCODE_IS_MOD(code) (IS_MOD(code) || (code >= QK_MODS && code <= QK_MODS_MAX && !(code & QK_BASIC_MAX)))
 
+void combo_init(void);
 bool process_combo(uint16_t keycode, keyrecord_t *record);
 void combo_task(void);
 void process_combo_event(uint16_t combo_index, bool pressed);
@@ -51,6 +51,10 @@ float default_layer_songs[][16][2] = DEFAULT_LAYER_SONGS;
 #    include "process_auto_shift.h"
 #endif
 
+#ifdef EEPROM_WRITE_BEHIND_ENABLE
+#    include "eeprom_driver.h"
+#endif
+
 uint8_t extract_mod_bits(uint16_t code) {
     switch (code) {
         case QK_MODS ... QK_MODS_MAX:
@@ -134,6 +138,9 @@ void reset_keyboard(void) {
 #endif
 #ifdef HAPTIC_ENABLE
     haptic_shutdown();
+#endif
+#ifdef EEPROM_WRITE_BEHIND_ENABLE
+    eeprom_write_behind_flush();
 #endif
     bootloader_jump();
 }
@@ -488,6 +495,10 @@ __attribute__((weak)) void suspend_power_down_user(void) {}
 __attribute__((weak)) void suspend_power_down_kb(void) { suspend_power_down_user(); }
 
 void suspend_power_down_quantum(void) {
+#ifdef EEPROM_WRITE_BEHIND_ENABLE
+    eeprom_write_behind_flush();
+#endif
+
 #ifndef NO_SUSPEND_POWER_DOWN
 // Turn off backlight
 #    ifdef BACKLIGHT_ENABLE
@@ -4,20 +4,48 @@
 
 typedef HSV (*reactive_splash_f)(HSV hsv, int16_t dx, int16_t dy, uint8_t dist, uint16_t tick);
 
-bool effect_runner_reactive_splash(uint8_t start, effect_params_t* params, reactive_splash_f effect_func) {
+// Narrows the distances, from inner to outer, at which a hit this old can still change an LED; false once it cannot change any
+typedef bool (*reactive_splash_reach_f)(uint16_t tick, uint8_t* inner, uint8_t* outer);
+
+bool effect_runner_reactive_splash_reach(uint8_t start, effect_params_t* params, reactive_splash_f effect_func, reactive_splash_reach_f reach_func) {
     RGB_MATRIX_USE_LIMITS(led_min, led_max);
 
+    // Hits that can still reach an LED, with the square of the nearest and furthest distance they reach
+    uint8_t  hits = 0;
+    uint8_t  hit_index[LED_HITS_TO_REMEMBER];
+    uint8_t  hit_outer[LED_HITS_TO_REMEMBER];
+    uint16_t hit_inner_sq[LED_HITS_TO_REMEMBER];
+    uint16_t hit_outer_sq[LED_HITS_TO_REMEMBER];
+    uint16_t hit_tick[LED_HITS_TO_REMEMBER];
+
     uint8_t count = g_last_hit_tracker.count;
+    for (uint8_t j = start; j < count; j++) {
+        uint16_t tick  = scale16by8(g_last_hit_tracker.tick[j], qadd8(rgb_matrix_config.speed, 1));
+        uint8_t  inner = 0, outer = UINT8_MAX;
+        if (reach_func && !reach_func(tick, &inner, &outer)) continue;
+
+        hit_index[hits]    = j;
+        hit_outer[hits]    = outer;
+        hit_inner_sq[hits] = inner * inner;
+        // sqrt16 rounds down, so every square below the next whole distance still counts as outer
+        hit_outer_sq[hits] = (outer + 1) * (outer + 1) - 1;
+        hit_tick[hits]     = tick;
+        hits++;
+    }
+
     for (uint8_t i = led_min; i < led_max; i++) {
         RGB_MATRIX_TEST_LED_FLAGS();
         HSV hsv = rgb_matrix_config.hsv;
         hsv.v   = 0;
-        for (uint8_t j = start; j < count; j++) {
-            int16_t  dx   = g_led_config.point[i].x - g_last_hit_tracker.x[j];
-            int16_t  dy   = g_led_config.point[i].y - g_last_hit_tracker.y[j];
-            uint8_t  dist = sqrt16(dx * dx + dy * dy);
-            uint16_t tick = scale16by8(g_last_hit_tracker.tick[j], qadd8(rgb_matrix_config.speed, 1));
-            hsv           = effect_func(hsv, dx, dy, dist, tick);
+        for (uint8_t k = 0; k < hits; k++) {
+            uint8_t j  = hit_index[k];
+            int16_t dx = g_led_config.point[i].x - g_last_hit_tracker.x[j];
+            int16_t dy = g_led_config.point[i].y - g_last_hit_tracker.y[j];
+            // A box around the hit rules out most LEDs before any multiplication
+            if (dx > hit_outer[k] || dx < -hit_outer[k] || dy > hit_outer[k] || dy < -hit_outer[k]) continue;
+            uint16_t dist_sq = dx * dx + dy * dy;
+            if (dist_sq < hit_inner_sq[k] || dist_sq > hit_outer_sq[k]) continue;
+            hsv = effect_func(hsv, dx, dy, sqrt16(dist_sq), hit_tick[k]);
         }
         hsv.v   = scale8(hsv.v, rgb_matrix_config.hsv.v);
         RGB rgb = rgb_matrix_hsv_to_rgb(hsv);
@@ -26,4 +54,6 @@ bool effect_runner_reactive_splash(uint8_t start, effect_params_t* params, react
     return rgb_matrix_check_finished_leds(led_max);
 }
 
+bool effect_runner_reactive_splash(uint8_t start, effect_params_t* params, reactive_splash_f effect_func) { return effect_runner_reactive_splash_reach(start, params, effect_func, NULL); }
+
 #endif  // RGB_MATRIX_KEYREACTIVE_ENABLED
@@ -11,7 +11,7 @@ RGB_MATRIX_EFFECT(SOLID_REACTIVE_MULTICROSS)
 
 #        ifdef RGB_MATRIX_CUSTOM_EFFECT_IMPLS
 
-static HSV SOLID_REACTIVE_CROSS_math(HSV hsv, int16_t dx, int16_t dy, uint8_t dist, uint16_t tick) {
+HSV SOLID_REACTIVE_CROSS_math(HSV hsv, int16_t dx, int16_t dy, uint8_t dist, uint16_t tick) {
     uint16_t effect = tick + dist;
     dx              = dx < 0 ? dx * -1 : dx;
     dy              = dy < 0 ? dy * -1 : dy;
@@ -23,12 +23,18 @@ static HSV SOLID_REACTIVE_CROSS_math(HSV hsv, int16_t dx, int16_t dy, uint8_t di
     return hsv;
 }
 
+bool SOLID_REACTIVE_CROSS_reach(uint16_t tick, uint8_t* inner, uint8_t* outer) {
+    if (tick > 254) return false;
+    *outer = 254 - tick;
+    return true;
+}
+
 #            ifdef ENABLE_RGB_MATRIX_SOLID_REACTIVE_CROSS
-bool SOLID_REACTIVE_CROSS(effect_params_t* params) { return effect_runner_reactive_splash(qsub8(g_last_hit_tracker.count, 1), params, &SOLID_REACTIVE_CROSS_math); }
+bool SOLID_REACTIVE_CROSS(effect_params_t* params) { return effect_runner_reactive_splash_reach(qsub8(g_last_hit_tracker.count, 1), params, &SOLID_REACTIVE_CROSS_math, &SOLID_REACTIVE_CROSS_reach); }
 #            endif
 
 #            ifdef ENABLE_RGB_MATRIX_SOLID_REACTIVE_MULTICROSS
-bool SOLID_REACTIVE_MULTICROSS(effect_params_t* params) { return effect_runner_reactive_splash(0, params, &SOLID_REACTIVE_CROSS_math); }
+bool SOLID_REACTIVE_MULTICROSS(effect_params_t* params) { return effect_runner_reactive_splash_reach(0, params, &SOLID_REACTIVE_CROSS_math, &SOLID_REACTIVE_CROSS_reach); }
 #            endif
 
 #        endif  // RGB_MATRIX_CUSTOM_EFFECT_IMPLS
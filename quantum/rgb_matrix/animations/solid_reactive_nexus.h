@@ -11,7 +11,7 @@ RGB_MATRIX_EFFECT(SOLID_REACTIVE_MULTINEXUS)
 
 #        ifdef RGB_MATRIX_CUSTOM_EFFECT_IMPLS
 
-static HSV SOLID_REACTIVE_NEXUS_math(HSV hsv, int16_t dx, int16_t dy, uint8_t dist, uint16_t tick) {
+HSV SOLID_REACTIVE_NEXUS_math(HSV hsv, int16_t dx, int16_t dy, uint8_t dist, uint16_t tick) {
     uint16_t effect = tick - dist;
     if (effect > 255) effect = 255;
     if (dist > 72) effect = 255;
@@ -21,12 +21,19 @@ static HSV SOLID_REACTIVE_NEXUS_math(HSV hsv, int16_t dx, int16_t dy, uint8_t di
     return hsv;
 }
 
+bool SOLID_REACTIVE_NEXUS_reach(uint16_t tick, uint8_t* inner, uint8_t* outer) {
+    if (tick > 254 + 72) return false;
+    *inner = tick > 254 ? tick - 254 : 0;
+    *outer = tick < 72 ? tick : 72;
+    return true;
+}
+
 #            ifdef ENABLE_RGB_MATRIX_SOLID_REACTIVE_NEXUS
-bool SOLID_REACTIVE_NEXUS(effect_params_t* params) { return effect_runner_reactive_splash(qsub8(g_last_hit_tracker.count, 1), params, &SOLID_REACTIVE_NEXUS_math); }
+bool SOLID_REACTIVE_NEXUS(effect_params_t* params) { return effect_runner_reactive_splash_reach(qsub8(g_last_hit_tracker.count, 1), params, &SOLID_REACTIVE_NEXUS_math, &SOLID_REACTIVE_NEXUS_reach); }
 #            endif
 
 #            ifdef ENABLE_RGB_MATRIX_SOLID_REACTIVE_MULTINEXUS
-bool SOLID_REACTIVE_MULTINEXUS(effect_params_t* params) { return effect_runner_reactive_splash(0, params, &SOLID_REACTIVE_NEXUS_math); }
+bool SOLID_REACTIVE_MULTINEXUS(effect_params_t* params) { return effect_runner_reactive_splash_reach(0, params, &SOLID_REACTIVE_NEXUS_math, &SOLID_REACTIVE_NEXUS_reach); }
 #            endif
 
 #        endif  // RGB_MATRIX_CUSTOM_EFFECT_IMPLS
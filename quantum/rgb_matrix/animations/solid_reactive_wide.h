@@ -11,19 +11,25 @@ RGB_MATRIX_EFFECT(SOLID_REACTIVE_MULTIWIDE)
 
 #        ifdef RGB_MATRIX_CUSTOM_EFFECT_IMPLS
 
-static HSV SOLID_REACTIVE_WIDE_math(HSV hsv, int16_t dx, int16_t dy, uint8_t dist, uint16_t tick) {
+HSV SOLID_REACTIVE_WIDE_math(HSV hsv, int16_t dx, int16_t dy, uint8_t dist, uint16_t tick) {
     uint16_t effect = tick + dist * 5;
     if (effect > 255) effect = 255;
     hsv.v = qadd8(hsv.v, 255 - effect);
     return hsv;
 }
 
+bool SOLID_REACTIVE_WIDE_reach(uint16_t tick, uint8_t* inner, uint8_t* outer) {
+    if (tick > 254) return false;
+    *outer = (254 - tick) / 5;
+    return true;
+}
+
 #            ifdef ENABLE_RGB_MATRIX_SOLID_REACTIVE_WIDE
-bool SOLID_REACTIVE_WIDE(effect_params_t* params) { return effect_runner_reactive_splash(qsub8(g_last_hit_tracker.count, 1), params, &SOLID_REACTIVE_WIDE_math); }
+bool SOLID_REACTIVE_WIDE(effect_params_t* params) { return effect_runner_reactive_splash_reach(qsub8(g_last_hit_tracker.count, 1), params, &SOLID_REACTIVE_WIDE_math, &SOLID_REACTIVE_WIDE_reach); }
 #            endif
 
 #            ifdef ENABLE_RGB_MATRIX_SOLID_REACTIVE_MULTIWIDE
-bool SOLID_REACTIVE_MULTIWIDE(effect_params_t* params) { return effect_runner_reactive_splash(0, params, &SOLID_REACTIVE_WIDE_math); }
+bool SOLID_REACTIVE_MULTIWIDE(effect_params_t* params) { return effect_runner_reactive_splash_reach(0, params, &SOLID_REACTIVE_WIDE_math, &SOLID_REACTIVE_WIDE_reach); }
 #            endif
 
 #        endif  // RGB_MATRIX_CUSTOM_EFFECT_IMPLS
@@ -36,9 +36,15 @@ static bool decrease_heatmap_values;
 
 bool TYPING_HEATMAP(effect_params_t* params) {
     // Modified version of RGB_MATRIX_USE_LIMITS to work off of matrix row / col size
+#        ifdef RGB_MATRIX_RENDER_BUDGET_US
+    // Spread the matrix positions over the LEDs of each iteration, so the last one ends with the last position
+    uint8_t led_min = params->led_min * sizeof(g_rgb_frame_buffer) / DRIVER_LED_TOTAL;
+    uint8_t led_max = params->led_max * sizeof(g_rgb_frame_buffer) / DRIVER_LED_TOTAL;
+#        else
     uint8_t led_min = RGB_MATRIX_LED_PROCESS_LIMIT * params->iter;
     uint8_t led_max = led_min + RGB_MATRIX_LED_PROCESS_LIMIT;
     if (led_max > sizeof(g_rgb_frame_buffer)) led_max = sizeof(g_rgb_frame_buffer);
+#        endif
 
     if (params->init) {
         rgb_matrix_set_color_all(0, 0, 0);
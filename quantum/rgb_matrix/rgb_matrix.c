@@ -33,6 +33,29 @@ const led_point_t k_rgb_matrix_center = RGB_MATRIX_CENTER;
 
 __attribute__((weak)) RGB rgb_matrix_hsv_to_rgb(HSV hsv) { return hsv_to_rgb(hsv); }
 
+#ifdef RGB_MATRIX_GEOMETRY_CACHE
+led_geometry_t g_led_geometry[DRIVER_LED_TOTAL];
+#endif  // RGB_MATRIX_GEOMETRY_CACHE
+
+// Distance and angle of an LED from the center, for runners and effects
+static inline uint8_t rgb_matrix_led_dist(uint8_t i) {
+#ifdef RGB_MATRIX_GEOMETRY_CACHE
+    return g_led_geometry[i].dist;
+#else
+    int16_t dx = g_led_config.point[i].x - k_rgb_matrix_center.x;
+    int16_t dy = g_led_config.point[i].y - k_rgb_matrix_center.y;
+    return sqrt16(dx * dx + dy * dy);
+#endif
+}
+
+static inline uint8_t rgb_matrix_led_angle(uint8_t i) {
+#ifdef RGB_MATRIX_GEOMETRY_CACHE
+    return g_led_geometry[i].angle;
+#else
+    return atan2_8(g_led_config.point[i].y - k_rgb_matrix_center.y, g_led_config.point[i].x - k_rgb_matrix_center.x);
+#endif
+}
+
 // Generic effect runners
 #include "rgb_matrix_runners.inc"
 
@@ -128,6 +151,16 @@ static rgb_task_states rgb_task_state    = SYNCING;
 static uint32_t rgb_anykey_timer;
 #endif  // RGB_DISABLE_TIMEOUT > 0
 
+#ifdef RGB_MATRIX_RENDER_BUDGET_US
+// render budget, with the cost of one LED in 1/16 us, zero until it has been measured
+static uint32_t                  rgb_render_led_cost = 0;
+static uint8_t                   rgb_render_slice    = RGB_MATRIX_LED_PROCESS_LIMIT < RGB_MATRIX_RENDER_SLICE_MAX ? RGB_MATRIX_LED_PROCESS_LIMIT : RGB_MATRIX_RENDER_SLICE_MAX;
+static uint16_t                  rgb_render_frames   = 0;
+static uint16_t                  rgb_render_worst    = 0;
+static uint32_t                  rgb_render_stats_timer;
+static rgb_matrix_render_stats_t rgb_render_stats;
+#endif  // RGB_MATRIX_RENDER_BUDGET_US
+
 // double buffers
 static uint32_t rgb_timer_buffer;
 #ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
@@ -293,6 +326,36 @@ static void rgb_task_timers(void) {
 #endif  // RGB_MATRIX_KEYREACTIVE_ENABLED
 }
 
+#ifdef RGB_MATRIX_RENDER_BUDGET_US
+#    ifdef TIMER_US_SUPPORTED
+#        define rgb_render_clock() timer_read_us()
+#    else
+// Slices cannot be timed finer than a millisecond here, so they stay at RGB_MATRIX_LED_PROCESS_LIMIT and are only timed for the stats
+#        define rgb_render_clock() (timer_read32() * 1000)
+#    endif
+
+static void rgb_task_measure(uint8_t leds, uint32_t elapsed_us) {
+    if (elapsed_us > rgb_render_worst) rgb_render_worst = elapsed_us > UINT16_MAX ? UINT16_MAX : elapsed_us;
+#    ifdef TIMER_US_SUPPORTED
+    if (!leds) return;
+
+    int32_t sample = elapsed_us * 16 / leds;
+    if (rgb_render_led_cost == 0) {
+        rgb_render_led_cost = sample;
+    } else {
+        rgb_render_led_cost += (sample - (int32_t)rgb_render_led_cost) / 8;
+    }
+
+    uint32_t slice = rgb_render_led_cost ? (uint32_t)RGB_MATRIX_RENDER_BUDGET_US * 16 / rgb_render_led_cost : RGB_MATRIX_RENDER_SLICE_MAX;
+    if (slice < 1) slice = 1;
+    if (slice > RGB_MATRIX_RENDER_SLICE_MAX) slice = RGB_MATRIX_RENDER_SLICE_MAX;
+    rgb_render_slice = slice;
+#    endif
+}
+
+rgb_matrix_render_stats_t rgb_matrix_get_render_stats(void) { return rgb_render_stats; }
+#endif  // RGB_MATRIX_RENDER_BUDGET_US
+
 static void rgb_task_sync(void) {
     eeconfig_flush_rgb_matrix(false);
     // next task
@@ -321,6 +384,14 @@ static void rgb_task_render(uint8_t effect) {
         rgb_matrix_set_color_all(0, 0, 0);
     }
 
+#ifdef RGB_MATRIX_RENDER_BUDGET_US
+    // pick up where the last iteration of this frame stopped, with as many LEDs as fit the budget
+    uint32_t render_start     = rgb_render_clock();
+    rgb_effect_params.led_min = rgb_effect_params.iter ? rgb_effect_params.led_max : 0;
+    rgb_effect_params.led_max = rgb_effect_params.led_min + rgb_render_slice;
+    if (rgb_effect_params.led_max > DRIVER_LED_TOTAL || rgb_effect_params.led_max < rgb_effect_params.led_min) rgb_effect_params.led_max = DRIVER_LED_TOTAL;
+#endif  // RGB_MATRIX_RENDER_BUDGET_US
+
     // each effect can opt to do calculations
     // and/or request PWM buffer updates.
     switch (effect) {
@@ -361,6 +432,10 @@ static void rgb_task_render(uint8_t effect) {
             return;
     }
 
+#ifdef RGB_MATRIX_RENDER_BUDGET_US
+    rgb_task_measure(rgb_effect_params.led_max - rgb_effect_params.led_min, TIMER_DIFF_32(rgb_render_clock(), render_start));
+#endif  // RGB_MATRIX_RENDER_BUDGET_US
+
     rgb_effect_params.iter++;
 
     // next task
@@ -381,6 +456,20 @@ static void rgb_task_flush(uint8_t effect) {
     // update pwm buffers
     rgb_matrix_update_pwm_buffers();
 
+#ifdef RGB_MATRIX_RENDER_BUDGET_US
+    rgb_render_frames++;
+    uint32_t stats_elapsed = timer_elapsed32(rgb_render_stats_timer);
+    if (stats_elapsed >= 1000) {
+        rgb_render_stats.fps            = (uint32_t)rgb_render_frames * 1000 / stats_elapsed;
+        rgb_render_stats.worst_slice_us = rgb_render_worst;
+        rgb_render_stats.slice_leds     = rgb_render_slice;
+        dprintf("rgb matrix render: %u fps, %u LEDs per slice, worst slice %u us\n", rgb_render_stats.fps, rgb_render_stats.slice_leds, rgb_render_stats.worst_slice_us);
+        rgb_render_frames      = 0;
+        rgb_render_worst       = 0;
+        rgb_render_stats_timer = timer_read32();
+    }
+#endif  // RGB_MATRIX_RENDER_BUDGET_US
+
     // next task
     rgb_task_state = SYNCING;
 }
@@ -410,7 +499,10 @@ void rgb_matrix_task(void) {
             }
             break;
         case FLUSHING:
-            rgb_task_flush(effect);
+            // wait for the previous frame to go out, rather than block on it
+            if (!rgb_matrix_driver.ready || rgb_matrix_driver.ready()) {
+                rgb_task_flush(effect);
+            }
             break;
         case SYNCING:
             rgb_task_sync();
@@ -433,7 +525,10 @@ void rgb_matrix_indicators_advanced(effect_params_t *params) {
      * and not sure which would be better. Otherwise, this should be called from
      * rgb_task_render, right before the iter++ line.
      */
-#if defined(RGB_MATRIX_LED_PROCESS_LIMIT) && RGB_MATRIX_LED_PROCESS_LIMIT > 0 && RGB_MATRIX_LED_PROCESS_LIMIT < DRIVER_LED_TOTAL
+#if defined(RGB_MATRIX_RENDER_BUDGET_US)
+    uint8_t min = params->led_min;
+    uint8_t max = params->led_max;
+#elif defined(RGB_MATRIX_LED_PROCESS_LIMIT) && RGB_MATRIX_LED_PROCESS_LIMIT > 0 && RGB_MATRIX_LED_PROCESS_LIMIT < DRIVER_LED_TOTAL
     uint8_t min = RGB_MATRIX_LED_PROCESS_LIMIT * (params->iter - 1);
     uint8_t max = min + RGB_MATRIX_LED_PROCESS_LIMIT;
     if (max > DRIVER_LED_TOTAL) max = DRIVER_LED_TOTAL;
@@ -449,8 +544,21 @@ __attribute__((weak)) void rgb_matrix_indicators_advanced_kb(uint8_t led_min, ui
 
 __attribute__((weak)) void rgb_matrix_indicators_advanced_user(uint8_t led_min, uint8_t led_max) {}
 
+void rgb_matrix_update_geometry(void) {
+#ifdef RGB_MATRIX_GEOMETRY_CACHE
+    for (uint8_t i = 0; i < DRIVER_LED_TOTAL; i++) {
+        int16_t dx = g_led_config.point[i].x - k_rgb_matrix_center.x;
+        int16_t dy = g_led_config.point[i].y - k_rgb_matrix_center.y;
+
+        g_led_geometry[i].dist  = sqrt16(dx * dx + dy * dy);
+        g_led_geometry[i].angle = atan2_8(dy, dx);
+    }
+#endif  // RGB_MATRIX_GEOMETRY_CACHE
+}
+
 void rgb_matrix_init(void) {
     rgb_matrix_driver.init();
+    rgb_matrix_update_geometry();
 
 #ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
     g_last_hit_tracker.count = 0;
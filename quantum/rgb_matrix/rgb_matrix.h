@@ -48,7 +48,24 @@
 #    define RGB_MATRIX_LED_PROCESS_LIMIT (DRIVER_LED_TOTAL + 4) / 5
 #endif
 
-#if defined(RGB_MATRIX_LED_PROCESS_LIMIT) && RGB_MATRIX_LED_PROCESS_LIMIT > 0 && RGB_MATRIX_LED_PROCESS_LIMIT < DRIVER_LED_TOTAL
+#ifndef RGB_MATRIX_RENDER_SLICE_MAX
+#    define RGB_MATRIX_RENDER_SLICE_MAX DRIVER_LED_TOTAL
+#endif
+
+#if defined(RGB_MATRIX_RENDER_BUDGET_US)
+#    if defined(RGB_MATRIX_SPLIT)
+#        define RGB_MATRIX_USE_LIMITS(min, max)                                                   \
+            uint8_t min                   = params->led_min;                                      \
+            uint8_t max                   = params->led_max;                                      \
+            uint8_t k_rgb_matrix_split[2] = RGB_MATRIX_SPLIT;                                     \
+            if (is_keyboard_left() && (max > k_rgb_matrix_split[0])) max = k_rgb_matrix_split[0]; \
+            if (!(is_keyboard_left()) && (min < k_rgb_matrix_split[0])) min = k_rgb_matrix_split[0];
+#    else
+#        define RGB_MATRIX_USE_LIMITS(min, max) \
+            uint8_t min = params->led_min;      \
+            uint8_t max = params->led_max;
+#    endif
+#elif defined(RGB_MATRIX_LED_PROCESS_LIMIT) && RGB_MATRIX_LED_PROCESS_LIMIT > 0 && RGB_MATRIX_LED_PROCESS_LIMIT < DRIVER_LED_TOTAL
 #    if defined(RGB_MATRIX_SPLIT)
 #        define RGB_MATRIX_USE_LIMITS(min, max)                                                   \
             uint8_t min = RGB_MATRIX_LED_PROCESS_LIMIT * params->iter;                            \
@@ -135,6 +152,11 @@ void rgb_matrix_indicators_advanced_kb(uint8_t led_min, uint8_t led_max);
 void rgb_matrix_indicators_advanced_user(uint8_t led_min, uint8_t led_max);
 
 void rgb_matrix_init(void);
+// Rebuilds the geometry cache, for keyboards that move LEDs in g_led_config at runtime
+void rgb_matrix_update_geometry(void);
+#ifdef RGB_MATRIX_RENDER_BUDGET_US
+rgb_matrix_render_stats_t rgb_matrix_get_render_stats(void);
+#endif
 
 void        rgb_matrix_set_suspend_state(bool state);
 bool        rgb_matrix_get_suspend_state(void);
@@ -232,6 +254,8 @@ typedef struct {
     void (*set_color_all)(uint8_t r, uint8_t g, uint8_t b);
     /* Flush any buffered changes to the hardware. */
     void (*flush)(void);
+    /* Optional, return false while the previous flush is still being sent. */
+    bool (*ready)(void);
 } rgb_matrix_driver_t;
 
 static inline bool rgb_matrix_check_finished_leds(uint8_t led_idx) {
@@ -258,3 +282,6 @@ extern last_hit_t g_last_hit_tracker;
 #ifdef RGB_MATRIX_FRAMEBUFFER_EFFECTS
 extern uint8_t g_rgb_frame_buffer[MATRIX_ROWS][MATRIX_COLS];
 #endif
+#ifdef RGB_MATRIX_GEOMETRY_CACHE
+extern led_geometry_t g_led_geometry[DRIVER_LED_TOTAL];
+#endif
@@ -18,7 +18,8 @@
 
 /* Each driver needs to define the struct
  *    const rgb_matrix_driver_t rgb_matrix_driver;
- * All members must be provided.
+ * All members must be provided, except ready, which may be left out if the
+ * driver can always take a new frame.
  * Keyboard custom drivers can define this in their own files, it should only
  * be here if shared between boards.
  */
@@ -324,5 +325,6 @@ const rgb_matrix_driver_t rgb_matrix_driver = {
     .flush         = flush,
     .set_color     = setled,
     .set_color_all = setled_all,
+    .ready         = ws2812_ready,
 };
 #endif
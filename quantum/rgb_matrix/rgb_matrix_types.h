@@ -57,8 +57,19 @@ typedef struct PACKED {
     uint8_t     iter;
     led_flags_t flags;
     bool        init;
+#ifdef RGB_MATRIX_RENDER_BUDGET_US
+    // LEDs to render in this iteration, from led_min up to but not including led_max
+    uint8_t led_min;
+    uint8_t led_max;
+#endif
 } effect_params_t;
 
+typedef struct PACKED {
+    uint16_t fps;             // Frames sent to the driver over the last second
+    uint16_t worst_slice_us;  // Longest single render iteration over the last second
+    uint8_t  slice_leds;      // LEDs currently rendered per iteration
+} rgb_matrix_render_stats_t;
+
 typedef struct PACKED {
     uint8_t x;
     uint8_t y;
@@ -76,6 +87,11 @@ typedef struct PACKED {
 
 #define NO_LED 255
 
+typedef struct PACKED {
+    uint8_t dist;
+    uint8_t angle;
+} led_geometry_t;
+
 typedef struct PACKED {
     uint8_t     matrix_co[MATRIX_ROWS][MATRIX_COLS];
     led_point_t point[DRIVER_LED_TOTAL];
@@ -798,6 +798,8 @@ void rgblight_wakeup(void) {
 
 __attribute__((weak)) void rgblight_call_driver(LED_TYPE *start_led, uint8_t num_leds) { ws2812_setleds(start_led, num_leds); }
 
+__attribute__((weak)) bool rgblight_driver_ready(void) { return ws2812_ready(); }
+
 #ifndef RGBLIGHT_CUSTOM_DRIVER
 
 void rgblight_set(void) {
@@ -1019,7 +1021,8 @@ void rgblight_task(void) {
             animation_status.pos16      = 0;  // restart signal to local each effect
         }
         uint16_t now = sync_timer_read();
-        if (timer_expired(now, animation_status.last_timer)) {
+        // a step that falls due while the previous frame is still being sent waits for the next pass
+        if (timer_expired(now, animation_status.last_timer) && rgblight_driver_ready()) {
 #    if defined(RGBLIGHT_SPLIT) && !defined(RGBLIGHT_SPLIT_NO_ANIMATION_SYNC)
             static uint16_t report_last_timer = 0;
             static bool     tick_flag         = false;
@@ -228,6 +228,196 @@ void send_string_with_delay_P(const char *str, uint8_t interval) {
     }
 }
 
+#ifdef SEND_STRING_QUEUE_SIZE
+#    if SEND_STRING_QUEUE_SIZE > 255
+#        error "SEND_STRING_QUEUE_SIZE must be less than 256"
+#    endif
+
+enum send_string_command_type {
+    SEND_STRING_KEY_DOWN,
+    SEND_STRING_KEY_UP,
+    SEND_STRING_DELAY,
+};
+
+typedef struct {
+    uint8_t  type;
+    uint8_t  keycode;
+    uint16_t delay;
+} send_string_command_t;
+
+typedef struct {
+    const char *           str;
+    const char *           pos;
+    send_string_callback_t callback;
+    uint8_t                interval;
+    bool                   progmem;
+} send_string_job_t;
+
+static send_string_job_t send_string_queue[SEND_STRING_QUEUE_SIZE];
+static uint8_t           send_string_queue_head  = 0;
+static uint8_t           send_string_queue_count = 0;
+
+// Commands for the character at the head of the queue; a single character expands to at most 11
+static send_string_command_t send_string_commands[12];
+static uint8_t               send_string_command_count = 0;
+static uint8_t               send_string_command_index = 0;
+static uint32_t              send_string_delay_start   = 0;
+static uint16_t              send_string_delay         = 0;
+
+static bool send_string_enqueue(const char *str, uint8_t interval, bool progmem, send_string_callback_t callback) {
+    if (send_string_queue_count >= SEND_STRING_QUEUE_SIZE) {
+        return false;
+    }
+
+    send_string_job_t *job = &send_string_queue[(send_string_queue_head + send_string_queue_count) % SEND_STRING_QUEUE_SIZE];
+    job->str               = str;
+    job->pos               = str;
+    job->callback          = callback;
+    job->interval          = interval;
+    job->progmem           = progmem;
+    send_string_queue_count++;
+    return true;
+}
+
+bool send_string_queued(const char *str, send_string_callback_t callback) { return send_string_enqueue(str, 0, false, callback); }
+
+bool send_string_queued_with_delay(const char *str, uint8_t interval, send_string_callback_t callback) { return send_string_enqueue(str, interval, false, callback); }
+
+bool send_string_queued_P(const char *str, send_string_callback_t callback) { return send_string_enqueue(str, 0, true, callback); }
+
+bool send_string_queued_with_delay_P(const char *str, uint8_t interval, send_string_callback_t callback) { return send_string_enqueue(str, interval, true, callback); }
+
+uint8_t send_string_queue_depth(void) { return send_string_queue_count; }
+
+static char send_string_read(send_string_job_t *job) { return job->progmem ? pgm_read_byte(job->pos) : *job->pos; }
+
+static void send_string_push(uint8_t type, uint8_t keycode, uint16_t delay) { send_string_commands[send_string_command_count++] = (send_string_command_t){.type = type, .keycode = keycode, .delay = delay}; }
+
+static void send_string_push_tap(uint8_t keycode) {
+    uint16_t delay = keycode == KC_CAPS_LOCK ? TAP_HOLD_CAPS_DELAY : TAP_CODE_DELAY;
+
+    send_string_push(SEND_STRING_KEY_DOWN, keycode, 0);
+    if (delay > 0) {
+        send_string_push(SEND_STRING_DELAY, 0, delay);
+    }
+    send_string_push(SEND_STRING_KEY_UP, keycode, 0);
+}
+
+// Expand the next character of the job into commands, the same way send_string_with_delay() would send it
+static bool send_string_expand(send_string_job_t *job) {
+    send_string_command_count = 0;
+    send_string_command_index = 0;
+
+    char ascii_code = send_string_read(job);
+    if (!ascii_code) {
+        return false;
+    }
+
+    if (ascii_code == SS_QMK_PREFIX) {
+        job->pos++;
+        ascii_code = send_string_read(job);
+        if (ascii_code == SS_TAP_CODE) {
+            job->pos++;
+            send_string_push_tap(send_string_read(job));
+        } else if (ascii_code == SS_DOWN_CODE) {
+            job->pos++;
+            send_string_push(SEND_STRING_KEY_DOWN, send_string_read(job), 0);
+        } else if (ascii_code == SS_UP_CODE) {
+            job->pos++;
+            send_string_push(SEND_STRING_KEY_UP, send_string_read(job), 0);
+        } else if (ascii_code == SS_DELAY_CODE) {
+            uint16_t ms = 0;
+            job->pos++;
+            while (isdigit(send_string_read(job))) {
+                ms *= 10;
+                ms += send_string_read(job) - '0';
+                job->pos++;
+            }
+            send_string_push(SEND_STRING_DELAY, 0, ms);
+        }
+#    if defined(AUDIO_ENABLE) && defined(SENDSTRING_BELL)
+    } else if (ascii_code == '\a') {
+        send_char(ascii_code);
+#    endif
+    } else {
+        uint8_t keycode    = pgm_read_byte(&ascii_to_keycode_lut[(uint8_t)ascii_code]);
+        bool    is_shifted = PGM_LOADBIT(ascii_to_shift_lut, (uint8_t)ascii_code);
+        bool    is_altgred = PGM_LOADBIT(ascii_to_altgr_lut, (uint8_t)ascii_code);
+        bool    is_dead    = PGM_LOADBIT(ascii_to_dead_lut, (uint8_t)ascii_code);
+
+        if (is_shifted) {
+            send_string_push(SEND_STRING_KEY_DOWN, KC_LSFT, 0);
+        }
+        if (is_altgred) {
+            send_string_push(SEND_STRING_KEY_DOWN, KC_RALT, 0);
+        }
+        send_string_push_tap(keycode);
+        if (is_altgred) {
+            send_string_push(SEND_STRING_KEY_UP, KC_RALT, 0);
+        }
+        if (is_shifted) {
+            send_string_push(SEND_STRING_KEY_UP, KC_LSFT, 0);
+        }
+        if (is_dead) {
+            send_string_push_tap(KC_SPACE);
+        }
+    }
+    job->pos++;
+
+    if (job->interval) {
+        send_string_push(SEND_STRING_DELAY, 0, job->interval);
+    }
+    return true;
+}
+
+/** \brief Sends at most one keyboard report of the queued strings.
+ *
+ * Called from keyboard_task(). Delays are waited out across calls, and a report is only
+ * sent once the host driver can accept it, so the rest of the firmware keeps running.
+ */
+void send_string_task(void) {
+    while (send_string_queue_count) {
+        if (send_string_delay) {
+            if (timer_elapsed32(send_string_delay_start) < send_string_delay) {
+                return;
+            }
+            send_string_delay = 0;
+        }
+
+        if (send_string_command_index >= send_string_command_count) {
+            send_string_job_t *job = &send_string_queue[send_string_queue_head];
+            if (!send_string_expand(job)) {
+                send_string_queue_head = (send_string_queue_head + 1) % SEND_STRING_QUEUE_SIZE;
+                send_string_queue_count--;
+                if (job->callback) {
+                    job->callback(job->str);
+                }
+            }
+            continue;
+        }
+
+        send_string_command_t *command = &send_string_commands[send_string_command_index];
+        if (command->type == SEND_STRING_DELAY) {
+            send_string_delay_start = timer_read32();
+            send_string_delay       = command->delay;
+            send_string_command_index++;
+            continue;
+        }
+
+        if (!host_keyboard_ready()) {
+            return;
+        }
+        if (command->type == SEND_STRING_KEY_DOWN) {
+            register_code(command->keycode);
+        } else {
+            unregister_code(command->keycode);
+        }
+        send_string_command_index++;
+        return;
+    }
+}
+#endif
+
 void send_char(char ascii_code) {
 #if defined(AUDIO_ENABLE) && defined(SENDSTRING_BELL)
     if (ascii_code == '\a') {  // BEL
@@ -15,6 +15,7 @@
  */
 
 #include <stdint.h>
+#include <stdbool.h>
 
 #include "progmem.h"
 #include "send_string_keycodes.h"
@@ -52,3 +53,20 @@ void send_byte(uint8_t number);
 void send_nibble(uint8_t number);
 
 void tap_random_base64(void);
+
+#ifdef SEND_STRING_QUEUE_SIZE
+// Called with the string that was passed in once all of it has been sent
+typedef void (*send_string_callback_t)(const char *str);
+
+#    define SEND_STRING_QUEUED(string, callback) send_string_queued_P(PSTR(string), callback)
+
+/* Queue a string to be typed from keyboard_task() without blocking. The string must stay
+ * valid until its callback runs. Returns false if SEND_STRING_QUEUE_SIZE strings are already queued.
+ */
+bool    send_string_queued(const char *str, send_string_callback_t callback);
+bool    send_string_queued_with_delay(const char *str, uint8_t interval, send_string_callback_t callback);
+bool    send_string_queued_P(const char *str, send_string_callback_t callback);
+bool    send_string_queued_with_delay_P(const char *str, uint8_t interval, send_string_callback_t callback);
+uint8_t send_string_queue_depth(void);
+void    send_string_task(void);
+#endif
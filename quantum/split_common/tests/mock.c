@@ -0,0 +1,133 @@
+/* Copyright 2022 QMK
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <string.h>
+#include "mock.h"
+#include "transactions.h"
+
+static split_shared_memory_t shared_memory;
+split_shared_memory_t *const split_shmem = &shared_memory;
+
+// Whichever half isn't currently running keeps its shared memory here
+static split_shared_memory_t peer_memory;
+
+uint32_t loopback_transactions     = 0;
+uint8_t  loopback_last_request_size = 0;
+uint8_t  loopback_corrupt_requests = 0;
+uint8_t  loopback_corrupt_replies  = 0;
+
+uint8_t mock_host_leds  = 0;
+uint8_t mock_slave_leds = 0;
+
+volatile bool isLeftHand = true;
+
+layer_state_t layer_state         = 0;
+layer_state_t default_layer_state = 0;
+
+static void loopback_swap(void) {
+    split_shared_memory_t temp;
+    memcpy(&temp, &shared_memory, sizeof(temp));
+    memcpy(&shared_memory, &peer_memory, sizeof(shared_memory));
+    memcpy(&peer_memory, &temp, sizeof(peer_memory));
+}
+
+void loopback_reset(void) {
+    memset(&shared_memory, 0, sizeof(shared_memory));
+    memset(&peer_memory, 0, sizeof(peer_memory));
+    loopback_transactions     = 0;
+    loopback_last_request_size = 0;
+    loopback_corrupt_requests = 0;
+    loopback_corrupt_replies  = 0;
+}
+
+void loopback_run_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    loopback_swap();
+    transport_slave(master_matrix, slave_matrix);
+    loopback_swap();
+}
+
+// Slave side of a transaction, with the master's shared memory in peer_memory
+static void loopback_slave_receive(split_transaction_desc_t *trans) {
+    uint8_t *peer = (uint8_t *)&peer_memory;
+    memcpy(split_trans_initiator2target_buffer(trans), peer + trans->initiator2target_offset, trans->initiator2target_buffer_size);
+    if (loopback_corrupt_requests > 0 && trans->initiator2target_buffer_size > 0) {
+        --loopback_corrupt_requests;
+        split_trans_initiator2target_buffer(trans)[trans->initiator2target_buffer_size - 1] ^= 0x5A;
+        split_trans_initiator2target_buffer(trans)[0] ^= 0xA5;
+    }
+}
+
+static void loopback_slave_reply(split_transaction_desc_t *trans) {
+    uint8_t *peer = (uint8_t *)&peer_memory;
+    if (trans->slave_callback) {
+        trans->slave_callback(trans->initiator2target_buffer_size, split_trans_initiator2target_buffer(trans), trans->target2initiator_buffer_size, split_trans_target2initiator_buffer(trans));
+    }
+    memcpy(peer + trans->target2initiator_offset, split_trans_target2initiator_buffer(trans), trans->target2initiator_buffer_size);
+}
+
+bool transport_execute_transaction(int8_t id, const void *initiator2target_buf, uint16_t initiator2target_length, void *target2initiator_buf, uint16_t target2initiator_length) {
+    split_transaction_desc_t *trans = &split_transaction_table[id];
+
+    ++loopback_transactions;
+    if (trans->initiator2target_buffer_size > 0) {
+        loopback_last_request_size = trans->initiator2target_buffer_size;
+    }
+
+    if (initiator2target_length > 0) {
+        size_t len = trans->initiator2target_buffer_size < initiator2target_length ? trans->initiator2target_buffer_size : initiator2target_length;
+        memcpy(split_trans_initiator2target_buffer(trans), initiator2target_buf, len);
+    }
+
+    // Switch over to the slave, and deliver the full buffers as the serial transport would
+    loopback_swap();
+#ifdef LOOPBACK_CALLBACK_BEFORE_RECEIVE
+    // The AVR soft serial target runs the callback and sends its reply before it receives the request
+    loopback_slave_reply(trans);
+    loopback_slave_receive(trans);
+#else   // LOOPBACK_CALLBACK_BEFORE_RECEIVE
+    // ChibiOS serial and I2C receive the request first
+    loopback_slave_receive(trans);
+    loopback_slave_reply(trans);
+#endif  // LOOPBACK_CALLBACK_BEFORE_RECEIVE
+    loopback_swap();
+
+    if (loopback_corrupt_replies > 0 && trans->target2initiator_buffer_size > 0) {
+        --loopback_corrupt_replies;
+        split_trans_target2initiator_buffer(trans)[0] ^= 0xA5;
+    }
+
+    if (target2initiator_length > 0) {
+        size_t len = trans->target2initiator_buffer_size < target2initiator_length ? trans->target2initiator_buffer_size : target2initiator_length;
+        memcpy(target2initiator_buf, split_trans_target2initiator_buffer(trans), len);
+    }
+
+    return true;
+}
+
+#ifdef SPLIT_TRANSPORT_BUNDLED
+// Reads the slave's reply on its own, without sending a frame first
+bool loopback_read_bundle_reply(split_bundle_s2m_t *reply) { return transport_execute_transaction(GET_BUNDLE_REPLY, NULL, 0, reply, sizeof(*reply)); }
+#endif  // SPLIT_TRANSPORT_BUNDLED
+
+bool transport_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) { return transactions_master(master_matrix, slave_matrix); }
+
+void transport_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) { transactions_slave(master_matrix, slave_matrix); }
+
+bool is_transport_connected(void) { return true; }
+
+uint8_t host_keyboard_leds(void) { return mock_host_leds; }
+
+void set_split_host_keyboard_leds(uint8_t led_state) { mock_slave_leds = led_state; }
@@ -0,0 +1,41 @@
+/* Copyright 2022 QMK
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "config.h"
+#include "transport.h"
+
+// Loopback stand-in for the split transport: both halves live in this process,
+// each with its own copy of the shared memory, and a transaction runs the
+// slave side synchronously in between the master's write and read phases.
+// Define LOOPBACK_CALLBACK_BEFORE_RECEIVE to run slave callbacks before the
+// request arrives, in the order of the AVR soft serial driver.
+extern uint32_t loopback_transactions;
+extern uint8_t  loopback_last_request_size;
+extern uint8_t  loopback_corrupt_requests;
+extern uint8_t  loopback_corrupt_replies;
+
+extern uint8_t mock_host_leds;
+extern uint8_t mock_slave_leds;
+
+void loopback_reset(void);
+void loopback_run_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]);
+#ifdef SPLIT_TRANSPORT_BUNDLED
+bool loopback_read_bundle_reply(split_bundle_s2m_t *reply);
+#endif  // SPLIT_TRANSPORT_BUNDLED
@@ -0,0 +1,39 @@
+SPLIT_TRANSACTIONS_COMMON_DEFS := -DNO_DEBUG -DIGNORE_ATOMIC_BLOCK -DSPLIT_COMMON_TRANSACTIONS
+
+SPLIT_TRANSACTIONS_COMMON_CONFIG := $(QUANTUM_PATH)/split_common/tests/config.h
+
+SPLIT_TRANSACTIONS_COMMON_INC := \
+	$(QUANTUM_PATH)/split_common/tests \
+	$(QUANTUM_PATH)/split_common
+
+SPLIT_TRANSACTIONS_COMMON_SRC := \
+	$(QUANTUM_PATH)/split_common/tests/mock.c \
+	$(QUANTUM_PATH)/split_common/tests/transactions_tests.cpp \
+	$(QUANTUM_PATH)/split_common/transactions.c \
+	$(QUANTUM_PATH)/crc.c \
+	$(PLATFORM_PATH)/test/timer.c
+
+split_transactions_DEFS := $(SPLIT_TRANSACTIONS_COMMON_DEFS)
+split_transactions_CONFIG := $(SPLIT_TRANSACTIONS_COMMON_CONFIG)
+split_transactions_INC := $(SPLIT_TRANSACTIONS_COMMON_INC)
+split_transactions_SRC := $(SPLIT_TRANSACTIONS_COMMON_SRC)
+
+split_transactions_bundled_DEFS := $(SPLIT_TRANSACTIONS_COMMON_DEFS) -DSPLIT_TRANSPORT_BUNDLED
+split_transactions_bundled_CONFIG := $(SPLIT_TRANSACTIONS_COMMON_CONFIG)
+split_transactions_bundled_INC := $(SPLIT_TRANSACTIONS_COMMON_INC)
+split_transactions_bundled_SRC := $(SPLIT_TRANSACTIONS_COMMON_SRC)
+
+split_transactions_bundled_callback_first_DEFS := $(SPLIT_TRANSACTIONS_COMMON_DEFS) -DSPLIT_TRANSPORT_BUNDLED -DLOOPBACK_CALLBACK_BEFORE_RECEIVE
+split_transactions_bundled_callback_first_CONFIG := $(SPLIT_TRANSACTIONS_COMMON_CONFIG)
+split_transactions_bundled_callback_first_INC := $(SPLIT_TRANSACTIONS_COMMON_INC)
+split_transactions_bundled_callback_first_SRC := $(SPLIT_TRANSACTIONS_COMMON_SRC)
+
+split_transactions_event_log_DEFS := $(SPLIT_TRANSACTIONS_COMMON_DEFS) -DSPLIT_MATRIX_EVENT_LOG_SIZE=8
+split_transactions_event_log_CONFIG := $(SPLIT_TRANSACTIONS_COMMON_CONFIG)
+split_transactions_event_log_INC := $(SPLIT_TRANSACTIONS_COMMON_INC)
+split_transactions_event_log_SRC := $(SPLIT_TRANSACTIONS_COMMON_SRC)
+
+split_transactions_event_log_callback_first_DEFS := $(SPLIT_TRANSACTIONS_COMMON_DEFS) -DSPLIT_MATRIX_EVENT_LOG_SIZE=8 -DLOOPBACK_CALLBACK_BEFORE_RECEIVE
+split_transactions_event_log_callback_first_CONFIG := $(SPLIT_TRANSACTIONS_COMMON_CONFIG)
+split_transactions_event_log_callback_first_INC := $(SPLIT_TRANSACTIONS_COMMON_INC)
+split_transactions_event_log_callback_first_SRC := $(SPLIT_TRANSACTIONS_COMMON_SRC)
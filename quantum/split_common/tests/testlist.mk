@@ -0,0 +1,6 @@
+TEST_LIST += \
+	split_transactions \
+	split_transactions_bundled \
+	split_transactions_bundled_callback_first \
+	split_transactions_event_log \
+	split_transactions_event_log_callback_first
@@ -0,0 +1,238 @@
+/* Copyright 2022 QMK
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "gtest/gtest.h"
+#include <string.h>
+
+extern "C" {
+#include "split_common/tests/mock.h"
+
+void     advance_time(uint32_t ms);
+uint16_t timer_read(void);
+uint32_t timer_read32(void);
+uint16_t split_matrix_event_time(uint8_t row, uint8_t col, uint16_t scan_time);
+}
+
+#define HALF_ROWS ((MATRIX_ROWS) / 2)
+
+class SplitTransactions : public ::testing::Test {
+   protected:
+    matrix_row_t master_side_master[HALF_ROWS];
+    matrix_row_t master_side_slave[HALF_ROWS];
+    matrix_row_t slave_side_master[HALF_ROWS];
+    matrix_row_t slave_side_slave[HALF_ROWS];
+
+    void SetUp() override {
+        loopback_reset();
+        memset(master_side_master, 0, sizeof(master_side_master));
+        memset(master_side_slave, 0, sizeof(master_side_slave));
+        memset(slave_side_master, 0, sizeof(slave_side_master));
+        memset(slave_side_slave, 0, sizeof(slave_side_slave));
+        layer_state         = 0;
+        default_layer_state = 0;
+        mock_host_leds      = 0;
+        mock_slave_leds     = 0;
+
+        // Start every test from a fully synchronised pair of halves
+        advance_time(FORCED_SYNC_THROTTLE_MS);
+        scan();
+        loopback_transactions = 0;
+    }
+
+    layer_state_t slave_layer_state;
+    layer_state_t slave_default_layer_state;
+
+    // Both halves share the layer state globals in this process, so keep the master's values out of the slave's way
+    void run_slave() {
+        layer_state_t master_layer_state         = layer_state;
+        layer_state_t master_default_layer_state = default_layer_state;
+        loopback_run_slave(slave_side_master, slave_side_slave);
+        slave_layer_state         = layer_state;
+        slave_default_layer_state = default_layer_state;
+        layer_state               = master_layer_state;
+        default_layer_state       = master_default_layer_state;
+    }
+
+    // One scan on each half: the slave publishes its state, the master talks to it, then the slave applies what it got
+    bool scan() {
+        run_slave();
+        bool okay = transport_master(master_side_master, master_side_slave);
+        run_slave();
+        advance_time(1);
+        return okay;
+    }
+};
+
+TEST_F(SplitTransactions, SlaveMatrixReachesMaster) {
+    slave_side_slave[0] = 0x01;
+    slave_side_slave[3] = 0x20;
+    EXPECT_TRUE(scan());
+    EXPECT_EQ(memcmp(master_side_slave, slave_side_slave, sizeof(slave_side_slave)), 0);
+
+    slave_side_slave[0] = 0;
+    EXPECT_TRUE(scan());
+    EXPECT_EQ(master_side_slave[0], 0);
+    EXPECT_EQ(master_side_slave[3], 0x20);
+}
+
+TEST_F(SplitTransactions, MasterStateReachesSlave) {
+    master_side_master[1] = 0x04;
+    layer_state           = 1 << 2;
+    default_layer_state   = 1 << 1;
+    mock_host_leds        = 0x02;
+    EXPECT_TRUE(scan());
+    EXPECT_EQ(slave_side_master[1], 0x04);
+    EXPECT_EQ(slave_layer_state, (layer_state_t)(1 << 2));
+    EXPECT_EQ(slave_default_layer_state, (layer_state_t)(1 << 1));
+    EXPECT_EQ(mock_slave_leds, 0x02);
+}
+
+TEST_F(SplitTransactions, CorruptReplyIsRetried) {
+    slave_side_slave[2] = 0x08;
+    loopback_corrupt_replies = 1;
+    EXPECT_TRUE(scan());
+    EXPECT_EQ(master_side_slave[2], 0x08);
+}
+
+TEST_F(SplitTransactions, RoundTripsPerScan) {
+    slave_side_slave[0]   = 0x10;
+    master_side_master[0] = 0x02;
+    layer_state           = 1 << 3;
+    mock_host_leds        = 0x01;
+    EXPECT_TRUE(scan());
+#ifdef SPLIT_TRANSPORT_BUNDLED
+    // the frame, then the slave's reply to it
+    EXPECT_EQ(loopback_transactions, 2u);
+#elif defined(SPLIT_MATRIX_EVENT_LOG_SIZE)
+    // log head with the first sequence number wanted, events, then mirror, layer state and LED state
+    EXPECT_EQ(loopback_transactions, 5u);
+#else
+    // checksum, matrix, mirror, layer state and LED state each take their own transaction
+    EXPECT_EQ(loopback_transactions, 5u);
+#endif
+}
+
+#ifdef SPLIT_TRANSPORT_BUNDLED
+
+TEST_F(SplitTransactions, IdleScanUsesSmallFrame) {
+    EXPECT_TRUE(scan());
+    EXPECT_EQ(loopback_last_request_size, sizeof(split_bundle_header_t) + SPLIT_TRANSPORT_BUNDLE_SMALL_SIZE);
+    // Nothing changed on the slave either, so its reply carries no records
+    EXPECT_EQ(split_shmem->bundle_s2m.header.length, 0);
+}
+
+TEST_F(SplitTransactions, ForcedSyncResendsEverything) {
+    advance_time(FORCED_SYNC_THROTTLE_MS);
+    EXPECT_TRUE(scan());
+    EXPECT_EQ(loopback_last_request_size, sizeof(split_bundle_header_t) + SPLIT_TRANSPORT_BUNDLE_SIZE);
+    EXPECT_EQ(split_shmem->bundle_s2m.header.length, 1 + sizeof(slave_side_slave));
+}
+
+TEST_F(SplitTransactions, CorruptRequestIsRejectedAndRetried) {
+    layer_state               = 1 << 4;
+    loopback_corrupt_requests = 1;
+    EXPECT_TRUE(scan());
+    EXPECT_EQ(loopback_transactions, 4u);
+    EXPECT_EQ(slave_layer_state, (layer_state_t)(1 << 4));
+}
+
+TEST_F(SplitTransactions, LostReplyIsResentInFull) {
+    // The slave believes it sent the new matrix, so the master has to ask for everything again
+    slave_side_slave[1]      = 0x3F;
+    loopback_corrupt_replies = 1;
+    EXPECT_TRUE(scan());
+    EXPECT_EQ(loopback_transactions, 4u);
+    EXPECT_EQ(master_side_slave[1], 0x3F);
+}
+
+TEST_F(SplitTransactions, FailedExchangeKeepsRecordsDue) {
+    // The sync timer is due, but every attempt at the frame carrying it fails
+    advance_time(FORCED_SYNC_THROTTLE_MS);
+    uint32_t last_sync_timer = split_shmem->sync_timer;
+    loopback_corrupt_replies = 10;
+    EXPECT_FALSE(scan());
+    EXPECT_EQ(split_shmem->sync_timer, last_sync_timer);
+
+    // So it goes out again on the next scan rather than a throttle period later
+    uint32_t scan_time = timer_read32();
+    EXPECT_TRUE(scan());
+    EXPECT_GE(split_shmem->sync_timer, scan_time);
+}
+
+TEST_F(SplitTransactions, ReplyWithoutFreshFrameIsRejected) {
+    layer_state = 1 << 5;
+    EXPECT_TRUE(scan());
+
+    // Reading another reply must not apply the frame the slave already consumed a second time
+    split_bundle_s2m_t reply;
+    run_slave();
+    EXPECT_TRUE(loopback_read_bundle_reply(&reply));
+    EXPECT_TRUE(reply.header.flags & SPLIT_BUNDLE_FLAG_REJECTED);
+}
+
+#endif  // SPLIT_TRANSPORT_BUNDLED
+
+#ifdef SPLIT_MATRIX_EVENT_LOG_SIZE
+
+TEST_F(SplitTransactions, IdleScanOnlyReadsLogHead) {
+    EXPECT_TRUE(scan());
+    EXPECT_EQ(loopback_transactions, 1u);
+}
+
+TEST_F(SplitTransactions, QuickTapSpansTwoScansWithSlaveTimestamps) {
+    // Both transitions happen on the slave before the master gets to poll it
+    uint16_t press_time = timer_read() | 1;
+    slave_side_slave[1] = 0x04;
+    run_slave();
+    advance_time(3);
+    uint16_t release_time = timer_read() | 1;
+    slave_side_slave[1]   = 0;
+    run_slave();
+    advance_time(5);
+
+    uint16_t scan_time    = timer_read() | 1;
+    loopback_transactions = 0;
+    EXPECT_TRUE(transport_master(master_side_master, master_side_slave));
+    // The log head exchanged for the first sequence number wanted, then the events, with no retries
+    EXPECT_EQ(loopback_transactions, 2u);
+    EXPECT_EQ(master_side_slave[1], 0x04);
+    EXPECT_EQ(split_matrix_event_time(HALF_ROWS + 1, 2, scan_time), press_time);
+    EXPECT_EQ(split_matrix_event_time(1, 2, scan_time), scan_time);
+
+    advance_time(1);
+    scan_time = timer_read() | 1;
+    EXPECT_TRUE(transport_master(master_side_master, master_side_slave));
+    EXPECT_EQ(master_side_slave[1], 0);
+    EXPECT_EQ(split_matrix_event_time(HALF_ROWS + 1, 2, scan_time), release_time);
+}
+
+TEST_F(SplitTransactions, LogOverflowFallsBackToFullMatrix) {
+    for (int i = 0; i < SPLIT_MATRIX_EVENT_LOG_SIZE + 1; ++i) {
+        slave_side_slave[0] ^= 0x01;
+        run_slave();
+        advance_time(1);
+    }
+    EXPECT_TRUE(scan());
+    EXPECT_TRUE(scan());
+    EXPECT_EQ(master_side_slave[0], 0x01);
+
+    // And events flow again once resynchronised
+    slave_side_slave[0] = 0;
+    EXPECT_TRUE(scan());
+    EXPECT_EQ(master_side_slave[0], 0);
+}
+
+#endif  // SPLIT_MATRIX_EVENT_LOG_SIZE
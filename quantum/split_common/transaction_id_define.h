@@ -24,6 +24,11 @@ enum serial_transaction_id {
     GET_SLAVE_MATRIX_CHECKSUM,
     GET_SLAVE_MATRIX_DATA,
 
+#ifdef SPLIT_MATRIX_EVENT_LOG_SIZE
+    GET_SLAVE_MATRIX_HEAD,
+    GET_SLAVE_MATRIX_EVENTS,
+#endif  // SPLIT_MATRIX_EVENT_LOG_SIZE
+
 #ifdef SPLIT_TRANSPORT_MIRROR
     PUT_MASTER_MATRIX,
 #endif  // SPLIT_TRANSPORT_MIRROR
@@ -78,6 +83,12 @@ enum serial_transaction_id {
     PUT_ST7565,
 #endif  // defined(ST7565_ENABLE) && defined(SPLIT_ST7565_ENABLE)
 
+#ifdef SPLIT_TRANSPORT_BUNDLED
+    PUT_BUNDLE_SMALL,
+    PUT_BUNDLE,
+    GET_BUNDLE_REPLY,
+#endif  // SPLIT_TRANSPORT_BUNDLED
+
 #if defined(SPLIT_TRANSACTION_IDS_KB) || defined(SPLIT_TRANSACTION_IDS_USER)
     PUT_RPC_INFO,
     PUT_RPC_REQ_DATA,
@@ -42,9 +42,19 @@
     { &dummy, 0, 0, sizeof_member(split_shared_memory_t, member), offsetof(split_shared_memory_t, member), cb }
 #define trans_target2initiator_initializer(member) trans_target2initiator_initializer_cb(member, NULL)
 
+#define trans_exchange_initializer_cb(initiator2target_member, target2initiator_member, cb) \
+    { &dummy, sizeof_member(split_shared_memory_t, initiator2target_member), offsetof(split_shared_memory_t, initiator2target_member), sizeof_member(split_shared_memory_t, target2initiator_member), offsetof(split_shared_memory_t, target2initiator_member), cb }
+
 #define transport_write(id, data, length) transport_execute_transaction(id, data, length, NULL, 0)
 #define transport_read(id, data, length) transport_execute_transaction(id, NULL, 0, data, length)
 
+#ifdef SPLIT_TRANSPORT_BUNDLED
+static bool bundle_write(int8_t id, const void *data, size_t length);
+#    define transaction_write(id, data, length) bundle_write(id, data, length)
+#else  // SPLIT_TRANSPORT_BUNDLED
+#    define transaction_write(id, data, length) transport_write(id, data, length)
+#endif  // SPLIT_TRANSPORT_BUNDLED
+
 #if defined(SPLIT_TRANSACTION_IDS_KB) || defined(SPLIT_TRANSACTION_IDS_USER)
 // Forward-declare the RPC callback handlers
 void slave_rpc_info_callback(uint8_t initiator2target_buffer_size, const void *initiator2target_buffer, uint8_t target2initiator_buffer_size, void *target2initiator_buffer);
@@ -70,16 +80,131 @@ static bool transaction_handler_master(matrix_row_t master_matrix[], matrix_row_
     return false;
 }
 
-#define TRANSACTION_HANDLER_MASTER(prefix)                                                                              \
-    do {                                                                                                                \
-        if (!transaction_handler_master(master_matrix, slave_matrix, #prefix, &prefix##_handlers_master)) return false; \
-    } while (0)
+#ifdef SPLIT_TRANSPORT_BUNDLED
+
+// Master handlers only queue records into the frame, anything that doesn't fit is picked up again on the next scan
+#    define TRANSACTION_HANDLER_MASTER(prefix)                                               \
+        do {                                                                                 \
+            ATOMIC_BLOCK_FORCEON { prefix##_handlers_master(master_matrix, slave_matrix); }; \
+        } while (0)
+
+#else  // SPLIT_TRANSPORT_BUNDLED
+
+#    define TRANSACTION_HANDLER_MASTER(prefix)                                                                              \
+        do {                                                                                                                \
+            if (!transaction_handler_master(master_matrix, slave_matrix, #prefix, &prefix##_handlers_master)) return false; \
+        } while (0)
+
+#endif  // SPLIT_TRANSPORT_BUNDLED
 
 #define TRANSACTION_HANDLER_SLAVE(prefix)                                               \
     do {                                                                                \
         ATOMIC_BLOCK_FORCEON { prefix##_handlers_slave(master_matrix, slave_matrix); }; \
     } while (0)
 
+#ifdef SPLIT_TRANSPORT_BUNDLED
+
+// Frame lengths, record offsets and transaction buffer sizes, which include the header, are all 8 bits wide
+_Static_assert(SPLIT_TRANSPORT_BUNDLE_SIZE <= UINT8_MAX - sizeof(split_bundle_header_t), "SPLIT_TRANSPORT_BUNDLE_SIZE must leave room for the frame header in 255 bytes");
+_Static_assert(SPLIT_TRANSPORT_BUNDLE_S2M_SIZE <= UINT8_MAX - sizeof(split_bundle_header_t), "Slave matrix and encoder state too large for a bundled reply");
+
+static uint8_t bundle_checksum(const split_bundle_header_t *frame) { return crc8(&frame->flags, sizeof(split_bundle_header_t) - offsetof(split_bundle_header_t, flags) + frame->length); }
+
+static void bundle_reset(split_bundle_header_t *frame, uint8_t flags) {
+    frame->flags  = flags;
+    frame->length = 0;
+}
+
+static void bundle_seal(split_bundle_header_t *frame) { frame->checksum = bundle_checksum(frame); }
+
+static bool bundle_is_valid(const split_bundle_header_t *frame, size_t capacity) { return frame->length <= capacity && frame->checksum == bundle_checksum(frame); }
+
+static bool bundle_put(split_bundle_header_t *frame, size_t capacity, int8_t id, const void *data, size_t length) {
+    uint8_t *payload = (uint8_t *)(frame + 1);
+    if (frame->length + 1 + length > capacity) {
+        return false;
+    }
+    payload[frame->length] = id;
+    memcpy(&payload[frame->length + 1], data, length);
+    frame->length += 1 + length;
+    return true;
+}
+
+// Copies each record of a validated frame into its shared memory region
+static bool bundle_unpack(const split_bundle_header_t *frame, bool initiator2target) {
+    const uint8_t *payload = (const uint8_t *)(frame + 1);
+    uint8_t        pos     = 0;
+    while (pos < frame->length) {
+        int8_t id = payload[pos++];
+        if (id < 0 || id >= NUM_TOTAL_TRANSACTIONS) {
+            return false;
+        }
+        split_transaction_desc_t *trans = &split_transaction_table[id];
+        uint8_t                   size  = initiator2target ? trans->initiator2target_buffer_size : trans->target2initiator_buffer_size;
+        if (size == 0 || pos + size > frame->length) {
+            return false;
+        }
+        memcpy(initiator2target ? split_trans_initiator2target_buffer(trans) : split_trans_target2initiator_buffer(trans), &payload[pos], size);
+        pos += size;
+    }
+    return true;
+}
+
+static split_bundle_m2s_t bundle_m2s;
+
+// What each queued record does once the slave has it, held back until the frame is accepted
+typedef struct _bundle_commit_t {
+    uint32_t *last_update;
+    void (*on_sent)(void);
+} bundle_commit_t;
+
+static bundle_commit_t bundle_commits[NUM_TOTAL_TRANSACTIONS];
+static uint8_t         bundle_commit_count = 0;
+
+inline static void transaction_commit(uint32_t *last_update, void (*on_sent)(void)) {
+    if (bundle_commit_count < sizeof(bundle_commits) / sizeof(bundle_commits[0])) {
+        bundle_commits[bundle_commit_count].last_update = last_update;
+        bundle_commits[bundle_commit_count].on_sent     = on_sent;
+        ++bundle_commit_count;
+    }
+}
+
+static void bundle_run_commits(void) {
+    for (uint8_t i = 0; i < bundle_commit_count; ++i) {
+        *bundle_commits[i].last_update = timer_read32();
+        if (bundle_commits[i].on_sent) {
+            bundle_commits[i].on_sent();
+        }
+    }
+    bundle_commit_count = 0;
+}
+
+static bool bundle_write(int8_t id, const void *data, size_t length) {
+    // Anything that can never fit in a frame still gets its own transaction
+    if (1 + length > sizeof(bundle_m2s.data)) {
+        return transport_write(id, data, length);
+    }
+    if (length != split_transaction_table[id].initiator2target_buffer_size) {
+        return false;
+    }
+    return bundle_put(&bundle_m2s.header, sizeof(bundle_m2s.data), id, data, length);
+}
+
+inline static bool read_if_checksum_mismatch(int8_t trans_id_checksum, int8_t trans_id_retrieve, uint32_t *last_update, void *destination, const void *equiv_shmem, size_t length) {
+    // The reply frame has already been validated and unpacked into shared memory
+    memcpy(destination, equiv_shmem, length);
+    return true;
+}
+
+#else  // SPLIT_TRANSPORT_BUNDLED
+
+inline static void transaction_commit(uint32_t *last_update, void (*on_sent)(void)) {
+    *last_update = timer_read32();
+    if (on_sent) {
+        on_sent();
+    }
+}
+
 inline static bool read_if_checksum_mismatch(int8_t trans_id_checksum, int8_t trans_id_retrieve, uint32_t *last_update, void *destination, const void *equiv_shmem, size_t length) {
     uint8_t curr_checksum;
     bool    okay = transport_read(trans_id_checksum, &curr_checksum, sizeof(curr_checksum));
@@ -95,17 +220,21 @@ inline static bool read_if_checksum_mismatch(int8_t trans_id_checksum, int8_t tr
     return okay;
 }
 
-inline static bool send_if_condition(int8_t trans_id, uint32_t *last_update, bool condition, void *source, size_t length) {
+#endif  // SPLIT_TRANSPORT_BUNDLED
+
+inline static bool send_if_condition_then(int8_t trans_id, uint32_t *last_update, bool condition, void *source, size_t length, void (*on_sent)(void)) {
     bool okay = true;
     if (timer_elapsed32(*last_update) >= FORCED_SYNC_THROTTLE_MS || condition) {
-        okay &= transport_write(trans_id, source, length);
+        okay &= transaction_write(trans_id, source, length);
         if (okay) {
-            *last_update = timer_read32();
+            transaction_commit(last_update, on_sent);
         }
     }
     return okay;
 }
 
+inline static bool send_if_condition(int8_t trans_id, uint32_t *last_update, bool condition, void *source, size_t length) { return send_if_condition_then(trans_id, last_update, condition, source, length, NULL); }
+
 inline static bool send_if_data_mismatch(int8_t trans_id, uint32_t *last_update, void *source, const void *equiv_shmem, size_t length) {
     // Just run a memcmp to compare the source and equivalent shmem location
     return send_if_condition(trans_id, last_update, (memcmp(source, equiv_shmem, length) != 0), source, length);
@@ -114,6 +243,160 @@ inline static bool send_if_data_mismatch(int8_t trans_id, uint32_t *last_update,
 ////////////////////////////////////////////////////
 // Slave matrix
 
+#ifdef SPLIT_MATRIX_EVENT_LOG_SIZE
+
+#    if defined(SPLIT_TRANSPORT_BUNDLED)
+#        error "SPLIT_MATRIX_EVENT_LOG_SIZE cannot be combined with SPLIT_TRANSPORT_BUNDLED"
+#    elif defined(DISABLE_SYNC_TIMER)
+#        error "SPLIT_MATRIX_EVENT_LOG_SIZE needs the sync timer to timestamp events"
+#    elif SPLIT_MATRIX_EVENT_LOG_SIZE > 128 || (SPLIT_MATRIX_EVENT_LOG_SIZE & (SPLIT_MATRIX_EVENT_LOG_SIZE - 1)) != 0
+#        error "SPLIT_MATRIX_EVENT_LOG_SIZE must be a power of two, no larger than 128"
+#    endif
+
+// Slave: every key transition seen by its scans, indexed by sequence number
+static split_matrix_event_t slave_event_log[SPLIT_MATRIX_EVENT_LOG_SIZE];
+static uint8_t              slave_event_log_head = 0;
+
+// Master: slave key transitions applied during the current scan, with the slave's timestamps
+static split_matrix_event_t applied_events[SPLIT_MATRIX_EVENTS_PER_TRANSFER];
+static uint8_t              applied_event_count = 0;
+
+static bool slave_matrix_full_sync(uint8_t head, matrix_row_t matrix[]) {
+    uint8_t curr_checksum;
+    uint8_t curr_head;
+    bool    okay = transport_read(GET_SLAVE_MATRIX_CHECKSUM, &curr_checksum, sizeof(curr_checksum));
+    okay         = okay && transport_read(GET_SLAVE_MATRIX_DATA, matrix, sizeof(split_shmem->smatrix.matrix));
+    okay         = okay && curr_checksum == crc8(matrix, sizeof(split_shmem->smatrix.matrix));
+    // The matrix only matches the log position if no events were logged while reading it
+    okay = okay && transport_read(GET_SLAVE_MATRIX_HEAD, &curr_head, sizeof(curr_head));
+    return okay && curr_head == head;
+}
+
+static bool slave_matrix_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    static uint32_t     last_update                    = 0;
+    static matrix_row_t last_matrix[(MATRIX_ROWS) / 2] = {0};  // last successfully-read matrix, so we can replicate if there are errors
+    static uint8_t      next_seq                       = 0;
+    static bool         synced                         = false;
+    uint8_t             head;
+
+    applied_event_count = 0;
+    // The first sequence number wanted rides along with the head, so it has reached the slave before the events are read
+    if (!transport_execute_transaction(GET_SLAVE_MATRIX_HEAD, &next_seq, sizeof(next_seq), &head, sizeof(head))) {
+        return false;
+    }
+
+    if (!synced || (head == next_seq && timer_elapsed32(last_update) >= FORCED_SYNC_THROTTLE_MS)) {
+        // Nothing in flight: adopt the full matrix and pick up the log from the current position
+        matrix_row_t temp_matrix[(MATRIX_ROWS) / 2];
+        if (!slave_matrix_full_sync(head, temp_matrix)) {
+            return false;
+        }
+        memcpy(last_matrix, temp_matrix, sizeof(temp_matrix));
+        next_seq    = head;
+        synced      = true;
+        last_update = timer_read32();
+    } else if (head != next_seq) {
+        split_matrix_events_reply_t reply;
+        if (!transport_read(GET_SLAVE_MATRIX_EVENTS, &reply, sizeof(reply))) {
+            return false;
+        }
+        if (reply.checksum != crc8(&reply.first_seq, sizeof(reply) - offsetof(split_matrix_events_reply_t, first_seq)) || reply.first_seq != next_seq) {
+            return false;
+        }
+        if (reply.count == SPLIT_MATRIX_EVENTS_OVERFLOW || reply.count > SPLIT_MATRIX_EVENTS_PER_TRANSFER) {
+            // Fell too far behind, so resynchronise from the full matrix on the next scan
+            synced = false;
+        } else {
+            // Apply at most one transition per key, so that a quick tap spans two scans instead of vanishing
+            matrix_row_t changed[(MATRIX_ROWS) / 2] = {0};
+            for (uint8_t i = 0; i < reply.count; ++i) {
+                split_matrix_event_t *event = &reply.events[i];
+                uint8_t               col   = event->col & ~SPLIT_MATRIX_EVENT_PRESSED;
+                matrix_row_t          mask  = (matrix_row_t)1 << col;
+                if (event->row >= (MATRIX_ROWS) / 2 || col >= MATRIX_COLS || (changed[event->row] & mask)) {
+                    break;
+                }
+                if (event->col & SPLIT_MATRIX_EVENT_PRESSED) {
+                    last_matrix[event->row] |= mask;
+                } else {
+                    last_matrix[event->row] &= ~mask;
+                }
+                changed[event->row] |= mask;
+                applied_events[applied_event_count++] = *event;
+                ++next_seq;
+            }
+            last_update = timer_read32();
+        }
+    }
+
+    memcpy(slave_matrix, last_matrix, sizeof(last_matrix));
+    return true;
+}
+
+static void slave_matrix_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    static matrix_row_t last_matrix[(MATRIX_ROWS) / 2] = {0};
+    uint16_t            now                            = sync_timer_read() | 1;
+
+    for (uint8_t row = 0; row < (MATRIX_ROWS) / 2; ++row) {
+        matrix_row_t change = slave_matrix[row] ^ last_matrix[row];
+        for (uint8_t col = 0; change; ++col, change >>= 1) {
+            if (change & 1) {
+                split_matrix_event_t *event = &slave_event_log[slave_event_log_head++ & (SPLIT_MATRIX_EVENT_LOG_SIZE - 1)];
+                event->row                  = row;
+                event->col                  = col | ((slave_matrix[row] & ((matrix_row_t)1 << col)) ? SPLIT_MATRIX_EVENT_PRESSED : 0);
+                event->time                 = now;
+            }
+        }
+    }
+    memcpy(last_matrix, slave_matrix, sizeof(last_matrix));
+
+    memcpy(split_shmem->smatrix.matrix, slave_matrix, sizeof(split_shmem->smatrix.matrix));
+    split_shmem->smatrix.checksum    = crc8(split_shmem->smatrix.matrix, sizeof(split_shmem->smatrix.matrix));
+    split_shmem->smatrix_events.head = slave_event_log_head;
+}
+
+static void slave_matrix_events_callback(uint8_t initiator2target_buffer_size, const void *initiator2target_buffer, uint8_t target2initiator_buffer_size, void *target2initiator_buffer) {
+    split_matrix_events_reply_t *reply   = &split_shmem->smatrix_events.reply;
+    uint8_t                      seq     = split_shmem->smatrix_events.request;
+    uint8_t                      pending = slave_event_log_head - seq;
+
+    memset(reply, 0, sizeof(*reply));
+    reply->first_seq = seq;
+    if (pending > SPLIT_MATRIX_EVENT_LOG_SIZE) {
+        reply->count = SPLIT_MATRIX_EVENTS_OVERFLOW;
+    } else {
+        reply->count = pending < SPLIT_MATRIX_EVENTS_PER_TRANSFER ? pending : SPLIT_MATRIX_EVENTS_PER_TRANSFER;
+        for (uint8_t i = 0; i < reply->count; ++i) {
+            reply->events[i] = slave_event_log[(uint8_t)(seq + i) & (SPLIT_MATRIX_EVENT_LOG_SIZE - 1)];
+        }
+    }
+    reply->checksum = crc8(&reply->first_seq, sizeof(*reply) - offsetof(split_matrix_events_reply_t, first_seq));
+}
+
+uint16_t split_matrix_event_time(uint8_t row, uint8_t col, uint16_t scan_time) {
+    uint8_t slave_row_offset = isLeftHand ? (MATRIX_ROWS) / 2 : 0;
+    for (uint8_t i = 0; i < applied_event_count; ++i) {
+        split_matrix_event_t *event = &applied_events[i];
+        if (event->row + slave_row_offset == row && (event->col & ~SPLIT_MATRIX_EVENT_PRESSED) == col) {
+            // Never report a time after the scan, which would look like a wrapped-around timer to the tapping code
+            return TIMER_DIFF_16(scan_time, event->time) < 0x8000 ? event->time : scan_time;
+        }
+    }
+    return scan_time;
+}
+
+// clang-format off
+#    define TRANSACTIONS_SLAVE_MATRIX_MASTER() TRANSACTION_HANDLER_MASTER(slave_matrix)
+#    define TRANSACTIONS_SLAVE_MATRIX_SLAVE() TRANSACTION_HANDLER_SLAVE(slave_matrix)
+#    define TRANSACTIONS_SLAVE_MATRIX_REGISTRATIONS \
+    [GET_SLAVE_MATRIX_CHECKSUM] = trans_target2initiator_initializer(smatrix.checksum), \
+    [GET_SLAVE_MATRIX_DATA]     = trans_target2initiator_initializer(smatrix.matrix), \
+    [GET_SLAVE_MATRIX_HEAD]     = trans_exchange_initializer_cb(smatrix_events.request, smatrix_events.head, NULL), \
+    [GET_SLAVE_MATRIX_EVENTS]   = trans_target2initiator_initializer_cb(smatrix_events.reply, slave_matrix_events_callback),
+// clang-format on
+
+#else  // SPLIT_MATRIX_EVENT_LOG_SIZE
+
 static bool slave_matrix_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
     static uint32_t     last_update                    = 0;
     static matrix_row_t last_matrix[(MATRIX_ROWS) / 2] = {0};  // last successfully-read matrix, so we can replicate if there are checksum errors
@@ -135,13 +418,15 @@ static void slave_matrix_handlers_slave(matrix_row_t master_matrix[], matrix_row
 }
 
 // clang-format off
-#define TRANSACTIONS_SLAVE_MATRIX_MASTER() TRANSACTION_HANDLER_MASTER(slave_matrix)
-#define TRANSACTIONS_SLAVE_MATRIX_SLAVE() TRANSACTION_HANDLER_SLAVE(slave_matrix)
-#define TRANSACTIONS_SLAVE_MATRIX_REGISTRATIONS \
+#    define TRANSACTIONS_SLAVE_MATRIX_MASTER() TRANSACTION_HANDLER_MASTER(slave_matrix)
+#    define TRANSACTIONS_SLAVE_MATRIX_SLAVE() TRANSACTION_HANDLER_SLAVE(slave_matrix)
+#    define TRANSACTIONS_SLAVE_MATRIX_REGISTRATIONS \
     [GET_SLAVE_MATRIX_CHECKSUM] = trans_target2initiator_initializer(smatrix.checksum), \
     [GET_SLAVE_MATRIX_DATA]     = trans_target2initiator_initializer(smatrix.matrix),
 // clang-format on
 
+#endif  // SPLIT_MATRIX_EVENT_LOG_SIZE
+
 ////////////////////////////////////////////////////
 // Master matrix
 
@@ -219,9 +504,9 @@ static bool sync_timer_handlers_master(matrix_row_t master_matrix[], matrix_row_
     bool okay = true;
     if (timer_elapsed32(last_update) >= FORCED_SYNC_THROTTLE_MS) {
         uint32_t sync_timer = sync_timer_read32() + SYNC_TIMER_OFFSET;
-        okay &= transport_write(PUT_SYNC_TIMER, &sync_timer, sizeof(sync_timer));
+        okay &= transaction_write(PUT_SYNC_TIMER, &sync_timer, sizeof(sync_timer));
         if (okay) {
-            last_update = timer_read32();
+            transaction_commit(&last_update, NULL);
         }
     }
     return okay;
@@ -340,9 +625,9 @@ static bool mods_handlers_master(matrix_row_t master_matrix[], matrix_row_t slav
 
     bool okay = true;
     if (mods_need_sync) {
-        okay &= transport_write(PUT_MODS, &new_mods, sizeof(new_mods));
+        okay &= transaction_write(PUT_MODS, &new_mods, sizeof(new_mods));
         if (okay) {
-            last_update = timer_read32();
+            transaction_commit(&last_update, NULL);
         }
     }
 
@@ -403,12 +688,7 @@ static bool rgblight_handlers_master(matrix_row_t master_matrix[], matrix_row_t
     static uint32_t     last_update = 0;
     rgblight_syncinfo_t rgblight_sync;
     rgblight_get_syncinfo(&rgblight_sync);
-    if (send_if_condition(PUT_RGBLIGHT, &last_update, (rgblight_sync.status.change_flags != 0), &rgblight_sync, sizeof(rgblight_sync))) {
-        rgblight_clear_change_flags();
-    } else {
-        return false;
-    }
-    return true;
+    return send_if_condition_then(PUT_RGBLIGHT, &last_update, (rgblight_sync.status.change_flags != 0), &rgblight_sync, sizeof(rgblight_sync), rgblight_clear_change_flags);
 }
 
 static void rgblight_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
@@ -578,6 +858,96 @@ static void st7565_handlers_slave(matrix_row_t master_matrix[], matrix_row_t sla
 
 #endif  // defined(ST7565_ENABLE) && defined(SPLIT_ST7565_ENABLE)
 
+////////////////////////////////////////////////////
+// Bundled frame
+
+#ifdef SPLIT_TRANSPORT_BUNDLED
+
+static bool bundle_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    static uint32_t    last_full_sync = 0;
+    static bool        resync         = true;
+    split_bundle_s2m_t reply;
+
+    bool full_sync          = resync || timer_elapsed32(last_full_sync) >= FORCED_SYNC_THROTTLE_MS;
+    bundle_m2s.header.flags = full_sync ? SPLIT_BUNDLE_FLAG_FULL_SYNC : 0;
+    bundle_seal(&bundle_m2s.header);
+
+    // The AVR soft serial target runs a transaction's callback before it receives the data, so the frame
+    // goes out on its own and the slave only builds its reply from it once that reply is read
+    int8_t id   = bundle_m2s.header.length <= SPLIT_TRANSPORT_BUNDLE_SMALL_SIZE ? PUT_BUNDLE_SMALL : PUT_BUNDLE;
+    bool   okay = transport_write(id, &bundle_m2s, sizeof(split_bundle_header_t) + bundle_m2s.header.length);
+    okay        = okay && transport_read(GET_BUNDLE_REPLY, &reply, sizeof(reply));
+    okay        = okay && bundle_is_valid(&reply.header, sizeof(reply.data)) && !(reply.header.flags & SPLIT_BUNDLE_FLAG_REJECTED);
+    if (okay) {
+        // Mirror what the slave now holds, so that the change detection in each handler compares against it
+        bundle_unpack(&bundle_m2s.header, true);
+        okay = bundle_unpack(&reply.header, false);
+    }
+
+    resync = !okay;
+    if (okay) {
+        bundle_run_commits();
+        if (full_sync) {
+            last_full_sync = timer_read32();
+        }
+    }
+    return okay;
+}
+
+static void slave_bundle_callback(uint8_t initiator2target_buffer_size, const void *initiator2target_buffer, uint8_t target2initiator_buffer_size, void *target2initiator_buffer) {
+    static const int8_t reply_ids[] = {
+        GET_SLAVE_MATRIX_DATA,
+#    ifdef ENCODER_ENABLE
+        GET_ENCODERS_DATA,
+#    endif  // ENCODER_ENABLE
+    };
+    static uint8_t last_sent[SPLIT_TRANSPORT_BUNDLE_S2M_SIZE];
+
+    split_bundle_header_t *request = &split_shmem->bundle_m2s.header;
+    split_bundle_header_t *reply   = (split_bundle_header_t *)target2initiator_buffer;
+
+    if (!bundle_is_valid(request, sizeof(split_shmem->bundle_m2s.data)) || !bundle_unpack(request, true)) {
+        bundle_reset(reply, SPLIT_BUNDLE_FLAG_REJECTED);
+    } else {
+        // Only send regions which changed since the last reply, unless the master lost track and asked for everything
+        bundle_reset(reply, 0);
+        uint8_t pos = 0;
+        for (uint8_t i = 0; i < sizeof(reply_ids) / sizeof(reply_ids[0]); ++i) {
+            split_transaction_desc_t *trans  = &split_transaction_table[reply_ids[i]];
+            const void *              region = split_trans_target2initiator_buffer(trans);
+            uint8_t                   size   = trans->target2initiator_buffer_size;
+            if ((request->flags & SPLIT_BUNDLE_FLAG_FULL_SYNC) || memcmp(&last_sent[pos], region, size) != 0) {
+                bundle_put(reply, sizeof(split_shmem->bundle_s2m.data), reply_ids[i], region, size);
+                memcpy(&last_sent[pos], region, size);
+            }
+            pos += size;
+        }
+        // Each frame is applied once, so a reply read without a fresh frame before it comes back rejected
+        request->checksum = ~request->checksum;
+    }
+    bundle_seal(reply);
+}
+
+// clang-format off
+#    define TRANSACTIONS_BUNDLE_MASTER() \
+    do { \
+        if (!transaction_handler_master(master_matrix, slave_matrix, "bundle", &bundle_handlers_master)) return false; \
+    } while (0)
+#    define trans_bundle_initializer(size) \
+    { &dummy, sizeof(split_bundle_header_t) + (size), offsetof(split_shared_memory_t, bundle_m2s), 0, 0, NULL }
+#    define TRANSACTIONS_BUNDLE_REGISTRATIONS \
+    [PUT_BUNDLE_SMALL] = trans_bundle_initializer(SPLIT_TRANSPORT_BUNDLE_SMALL_SIZE), \
+    [PUT_BUNDLE]       = trans_bundle_initializer(SPLIT_TRANSPORT_BUNDLE_SIZE), \
+    [GET_BUNDLE_REPLY] = trans_target2initiator_initializer_cb(bundle_s2m, slave_bundle_callback),
+// clang-format on
+
+#else  // SPLIT_TRANSPORT_BUNDLED
+
+#    define TRANSACTIONS_BUNDLE_MASTER()
+#    define TRANSACTIONS_BUNDLE_REGISTRATIONS
+
+#endif  // SPLIT_TRANSPORT_BUNDLED
+
 ////////////////////////////////////////////////////
 
 uint8_t                  dummy;
@@ -604,6 +974,7 @@ split_transaction_desc_t split_transaction_table[NUM_TOTAL_TRANSACTIONS] = {
     TRANSACTIONS_WPM_REGISTRATIONS
     TRANSACTIONS_OLED_REGISTRATIONS
     TRANSACTIONS_ST7565_REGISTRATIONS
+    TRANSACTIONS_BUNDLE_REGISTRATIONS
 // clang-format on
 
 #if defined(SPLIT_TRANSACTION_IDS_KB) || defined(SPLIT_TRANSACTION_IDS_USER)
@@ -615,9 +986,17 @@ split_transaction_desc_t split_transaction_table[NUM_TOTAL_TRANSACTIONS] = {
 };
 
 bool transactions_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+#ifdef SPLIT_TRANSPORT_BUNDLED
+    // Queue everything for the slave into one frame, exchange it, then consume the slave's reply
+    bundle_reset(&bundle_m2s.header, 0);
+    bundle_commit_count = 0;
+#else   // SPLIT_TRANSPORT_BUNDLED
     TRANSACTIONS_SLAVE_MATRIX_MASTER();
+#endif  // SPLIT_TRANSPORT_BUNDLED
     TRANSACTIONS_MASTER_MATRIX_MASTER();
+#ifndef SPLIT_TRANSPORT_BUNDLED
     TRANSACTIONS_ENCODERS_MASTER();
+#endif  // SPLIT_TRANSPORT_BUNDLED
     TRANSACTIONS_SYNC_TIMER_MASTER();
     TRANSACTIONS_LAYER_STATE_MASTER();
     TRANSACTIONS_LED_STATE_MASTER();
@@ -629,6 +1008,11 @@ bool transactions_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix
     TRANSACTIONS_WPM_MASTER();
     TRANSACTIONS_OLED_MASTER();
     TRANSACTIONS_ST7565_MASTER();
+#ifdef SPLIT_TRANSPORT_BUNDLED
+    TRANSACTIONS_BUNDLE_MASTER();
+    TRANSACTIONS_SLAVE_MATRIX_MASTER();
+    TRANSACTIONS_ENCODERS_MASTER();
+#endif  // SPLIT_TRANSPORT_BUNDLED
     return true;
 }
 
@@ -46,6 +46,11 @@ extern split_transaction_desc_t split_transaction_table[NUM_TOTAL_TRANSACTIONS];
 bool transactions_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]);
 void transactions_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]);
 
+#ifdef SPLIT_MATRIX_EVENT_LOG_SIZE
+// returns the slave's timestamp for a change to a slave-side key applied during this scan, or scan_time otherwise
+uint16_t split_matrix_event_time(uint8_t row, uint8_t col, uint16_t scan_time);
+#endif  // SPLIT_MATRIX_EVENT_LOG_SIZE
+
 void transaction_register_rpc(int8_t transaction_id, slave_callback_t callback);
 
 bool transaction_rpc_exec(int8_t transaction_id, uint8_t initiator2target_buffer_size, const void *initiator2target_buffer, uint8_t target2initiator_buffer_size, void *target2initiator_buffer);
@@ -58,6 +58,35 @@ typedef struct _split_slave_matrix_sync_t {
     matrix_row_t matrix[(MATRIX_ROWS) / 2];
 } split_slave_matrix_sync_t;
 
+#ifdef SPLIT_MATRIX_EVENT_LOG_SIZE
+#    ifndef SPLIT_MATRIX_EVENTS_PER_TRANSFER
+#        define SPLIT_MATRIX_EVENTS_PER_TRANSFER 4
+#    endif  // SPLIT_MATRIX_EVENTS_PER_TRANSFER
+
+// Reply count used when the requested events have already been dropped from the slave's log
+#    define SPLIT_MATRIX_EVENTS_OVERFLOW 0xFF
+#    define SPLIT_MATRIX_EVENT_PRESSED 0x80
+
+typedef struct _split_matrix_event_t {
+    uint8_t  row;   // row within the slave half
+    uint8_t  col;   // column, ORed with SPLIT_MATRIX_EVENT_PRESSED for a press
+    uint16_t time;  // sync_timer_read() of the slave scan which saw the change
+} split_matrix_event_t;
+
+typedef struct _split_matrix_events_reply_t {
+    uint8_t              checksum;  // crc8 of the rest of the reply
+    uint8_t              first_seq;
+    uint8_t              count;
+    split_matrix_event_t events[SPLIT_MATRIX_EVENTS_PER_TRANSFER];
+} split_matrix_events_reply_t;
+
+typedef struct _split_slave_matrix_events_sync_t {
+    uint8_t                     head;     // sequence number of the next event the slave logs
+    uint8_t                     request;  // first sequence number the master hasn't applied yet
+    split_matrix_events_reply_t reply;
+} split_slave_matrix_events_sync_t;
+#endif  // SPLIT_MATRIX_EVENT_LOG_SIZE
+
 #ifdef SPLIT_TRANSPORT_MIRROR
 typedef struct _split_master_matrix_sync_t {
     matrix_row_t matrix[(MATRIX_ROWS) / 2];
@@ -114,6 +143,44 @@ typedef struct _rpc_sync_info_t {
 } rpc_sync_info_t;
 #endif  // defined(SPLIT_TRANSACTION_IDS_KB) || defined(SPLIT_TRANSACTION_IDS_USER)
 
+#ifdef SPLIT_TRANSPORT_BUNDLED
+#    ifndef SPLIT_TRANSPORT_BUNDLE_SIZE
+#        define SPLIT_TRANSPORT_BUNDLE_SIZE 32
+#    endif  // SPLIT_TRANSPORT_BUNDLE_SIZE
+
+// Frames with no more than this many payload bytes use the shorter transaction
+#    define SPLIT_TRANSPORT_BUNDLE_SMALL_SIZE 8
+
+#    ifdef ENCODER_ENABLE
+#        define SPLIT_TRANSPORT_BUNDLE_S2M_ENCODERS_SIZE (1 + NUMBER_OF_ENCODERS)
+#    else  // ENCODER_ENABLE
+#        define SPLIT_TRANSPORT_BUNDLE_S2M_ENCODERS_SIZE 0
+#    endif  // ENCODER_ENABLE
+
+// The slave only ever replies with its matrix and encoder state, so its frame is sized to fit both
+#    define SPLIT_TRANSPORT_BUNDLE_S2M_SIZE (1 + sizeof(matrix_row_t) * ((MATRIX_ROWS) / 2) + SPLIT_TRANSPORT_BUNDLE_S2M_ENCODERS_SIZE)
+
+#    define SPLIT_BUNDLE_FLAG_FULL_SYNC (1 << 0)  // master: include every slave region, not just the changed ones
+#    define SPLIT_BUNDLE_FLAG_REJECTED (1 << 1)   // slave: the master frame failed validation and was dropped
+
+typedef struct _split_bundle_header_t {
+    uint8_t checksum;  // crc8 of the remaining header fields and the used part of the payload
+    uint8_t flags;
+    uint8_t length;  // number of payload bytes in use
+} split_bundle_header_t;
+
+// Payloads are a sequence of records, each a transaction ID followed by that transaction's buffer
+typedef struct _split_bundle_m2s_t {
+    split_bundle_header_t header;
+    uint8_t               data[SPLIT_TRANSPORT_BUNDLE_SIZE];
+} split_bundle_m2s_t;
+
+typedef struct _split_bundle_s2m_t {
+    split_bundle_header_t header;
+    uint8_t               data[SPLIT_TRANSPORT_BUNDLE_S2M_SIZE];
+} split_bundle_s2m_t;
+#endif  // SPLIT_TRANSPORT_BUNDLED
+
 typedef struct _split_shared_memory_t {
 #ifdef USE_I2C
     int8_t transaction_id;
@@ -121,6 +188,10 @@ typedef struct _split_shared_memory_t {
 
     split_slave_matrix_sync_t smatrix;
 
+#ifdef SPLIT_MATRIX_EVENT_LOG_SIZE
+    split_slave_matrix_events_sync_t smatrix_events;
+#endif  // SPLIT_MATRIX_EVENT_LOG_SIZE
+
 #ifdef SPLIT_TRANSPORT_MIRROR
     split_master_matrix_sync_t mmatrix;
 #endif  // SPLIT_TRANSPORT_MIRROR
@@ -173,6 +244,11 @@ typedef struct _split_shared_memory_t {
     uint8_t current_st7565_state;
 #endif  // ST7565_ENABLE(OLED_ENABLE) && defined(SPLIT_ST7565_ENABLE)
 
+#ifdef SPLIT_TRANSPORT_BUNDLED
+    split_bundle_m2s_t bundle_m2s;
+    split_bundle_s2m_t bundle_s2m;
+#endif  // SPLIT_TRANSPORT_BUNDLED
+
 #if defined(SPLIT_TRANSACTION_IDS_KB) || defined(SPLIT_TRANSACTION_IDS_USER)
     rpc_sync_info_t rpc_info;
     uint8_t         rpc_m2s_buffer[RPC_M2S_BUFFER_SIZE];
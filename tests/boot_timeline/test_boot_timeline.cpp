@@ -0,0 +1,97 @@
+/* Copyright 2022 QMK
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <cstring>
+#include "gtest/gtest.h"
+#include "keyboard_report_util.hpp"
+#include "test_common.hpp"
+
+extern "C" {
+#include "deferred_exec.h"
+#include "usb_device_state.h"
+
+void advance_time(uint32_t ms);
+}
+
+static int deferred_init_count = 0;
+
+extern "C" void keyboard_deferred_init_user(void) { deferred_init_count++; }
+
+// Stands in for a slow peripheral brought up during keyboard_init()
+extern "C" void keyboard_post_init_user(void) { advance_time(7); }
+
+static const boot_timeline_entry_t *find_step(const char *name) {
+    for (uint8_t i = 0; i < boot_timeline_count(); i++) {
+        if (strcmp(boot_timeline_get(i)->name, name) == 0) {
+            return boot_timeline_get(i);
+        }
+    }
+    return nullptr;
+}
+
+static void run_deferred(void) {
+    advance_time(1);
+    deferred_exec_task();
+}
+
+/* keyboard_init() runs once per test suite, so each boot scenario gets a suite of its own */
+class BootWithHost : public TestFixture {};
+
+TEST_F(BootWithHost, DeferredInitWaitsForFirstScanAndHost) {
+    TestDriver driver;
+    usb_device_state = USB_DEVICE_STATE_INIT;
+
+    ASSERT_NE(find_step("matrix"), nullptr);
+    ASSERT_NE(find_step("keyboard_post_init_kb"), nullptr);
+    EXPECT_EQ(find_step("keyboard_post_init_kb")->duration, 7);
+    EXPECT_EQ(find_step("first scan"), nullptr);
+
+    run_deferred();
+    EXPECT_EQ(deferred_init_count, 0);
+
+    run_one_scan_loop();
+    ASSERT_NE(find_step("first scan"), nullptr);
+    EXPECT_EQ(find_step("first scan")->start, 7 + 1);  // after init, and the millisecond spent above
+
+    run_deferred();
+    EXPECT_EQ(deferred_init_count, 0);
+    EXPECT_FALSE(keyboard_deferred_init_done());
+
+    usb_device_state = USB_DEVICE_STATE_CONFIGURED;
+    run_deferred();
+    EXPECT_EQ(deferred_init_count, 1);
+    EXPECT_TRUE(keyboard_deferred_init_done());
+    EXPECT_NE(find_step("keyboard_deferred_init_kb"), nullptr);
+
+    run_deferred();
+    EXPECT_EQ(deferred_init_count, 1);
+}
+
+class BootWithoutHost : public TestFixture {};
+
+TEST_F(BootWithoutHost, DeferredInitTimesOut) {
+    TestDriver driver;
+    usb_device_state    = USB_DEVICE_STATE_INIT;
+    deferred_init_count = 0;
+
+    run_one_scan_loop();
+    while (!keyboard_deferred_init_done()) {
+        run_deferred();
+    }
+    EXPECT_EQ(deferred_init_count, 1);
+    ASSERT_NE(find_step("keyboard_deferred_init_kb"), nullptr);
+    EXPECT_GE(find_step("keyboard_deferred_init_kb")->start, DEFERRED_INIT_TIMEOUT);
+}
@@ -0,0 +1,228 @@
+/* Copyright 2022 QMK
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include "gtest/gtest.h"
+#include "keyboard_report_util.hpp"
+#include "test_common.hpp"
+
+extern "C" {
+#include "process_combo.h"
+}
+
+using testing::_;
+using testing::AnyNumber;
+using testing::InSequence;
+
+/* One real combo, A+B -> Z, among a few hundred that never complete. Some of
+ * those share KC_A, the rest use keys that are not in the keymap. */
+static uint16_t ab_keys[]                   = {KC_A, KC_B, COMBO_END};
+static uint16_t filler_keys[COMBO_COUNT][3] = {};
+
+extern "C" {
+combo_t         key_combos[COMBO_COUNT];
+extern uint32_t combo_visits;
+}
+
+static struct combo_setup {
+    combo_setup() {
+        key_combos[0] = (combo_t){.keys = ab_keys, .keycode = KC_Z};
+        for (uint16_t i = 1; i < COMBO_COUNT; i++) {
+            filler_keys[i][0] = (i % 50 == 0) ? KC_A : (uint16_t)(KC_F13 + (i % 12));
+            filler_keys[i][1] = KC_KP_1 + ((i / 12) % 9);
+            filler_keys[i][2] = COMBO_END;
+            key_combos[i]     = (combo_t){.keys = filler_keys[i], .keycode = KC_Y};
+        }
+    }
+} combo_setup;
+
+class Combo : public TestFixture {};
+
+TEST_F(Combo, ChordFiresCombo) {
+    TestDriver driver;
+    InSequence s;
+    auto       key_a = KeymapKey(0, 0, 0, KC_A);
+    auto       key_b = KeymapKey(0, 1, 0, KC_B);
+
+    set_keymap({key_a, key_b});
+
+    EXPECT_CALL(driver, send_keyboard_mock(_)).Times(0);
+    key_a.press();
+    run_one_scan_loop();
+    key_b.press();
+    run_one_scan_loop();
+    testing::Mock::VerifyAndClearExpectations(&driver);
+
+    EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_Z)));
+    idle_for(COMBO_TERM + 1);
+    testing::Mock::VerifyAndClearExpectations(&driver);
+
+    EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport()));
+    key_a.release();
+    run_one_scan_loop();
+    key_b.release();
+    run_one_scan_loop();
+    testing::Mock::VerifyAndClearExpectations(&driver);
+}
+
+TEST_F(Combo, SingleComboKeyIsSentAfterComboTerm) {
+    TestDriver driver;
+    InSequence s;
+    auto       key_a = KeymapKey(0, 0, 0, KC_A);
+
+    set_keymap({key_a});
+
+    EXPECT_CALL(driver, send_keyboard_mock(_)).Times(0);
+    key_a.press();
+    run_one_scan_loop();
+    testing::Mock::VerifyAndClearExpectations(&driver);
+
+    EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_A)));
+    idle_for(COMBO_TERM + 1);
+    testing::Mock::VerifyAndClearExpectations(&driver);
+
+    EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport()));
+    key_a.release();
+    run_one_scan_loop();
+    testing::Mock::VerifyAndClearExpectations(&driver);
+}
+
+TEST_F(Combo, ComboKeyTappedAloneIsSent) {
+    TestDriver driver;
+    InSequence s;
+    auto       key_b = KeymapKey(0, 1, 0, KC_B);
+
+    set_keymap({key_b});
+
+    EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_B)));
+    EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport()));
+    key_b.press();
+    run_one_scan_loop();
+    key_b.release();
+    run_one_scan_loop();
+    testing::Mock::VerifyAndClearExpectations(&driver);
+}
+
+TEST_F(Combo, NonComboKeyIsSentImmediately) {
+    TestDriver driver;
+    InSequence s;
+    auto       key_c = KeymapKey(0, 2, 0, KC_C);
+
+    set_keymap({key_c});
+
+    EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_C)));
+    key_c.press();
+    run_one_scan_loop();
+    testing::Mock::VerifyAndClearExpectations(&driver);
+
+    EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport()));
+    key_c.release();
+    run_one_scan_loop();
+    testing::Mock::VerifyAndClearExpectations(&driver);
+}
+
+/* Best time of a few rounds of the given events, per event. */
+template <typename F>
+static double best_ns_per_event(F events) {
+    const int iterations = 20000;
+    double    best       = 1e30;
+
+    for (int round = 0; round < 5; round++) {
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < iterations; i++) {
+            events(i);
+        }
+        best = std::min(best, (double)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count() / iterations);
+    }
+    return best;
+}
+
+/* Counts the combos process_combo() checks per key event: every combo for a
+ * linear scan, only those containing the key with the index. */
+TEST_F(Combo, CombosVisitedPerKey) {
+    TestDriver driver;
+    auto       key_a = KeymapKey(0, 0, 0, KC_A);
+    auto       key_c = KeymapKey(0, 2, 0, KC_C);
+
+    set_keymap({key_a, key_c});
+
+    EXPECT_CALL(driver, send_keyboard_mock(_)).Times(AnyNumber());
+
+    auto visits = [](KeymapKey& key) {
+        keyrecord_t record   = {};
+        record.event.key     = key.position;
+        record.event.pressed = true;
+        record.event.time    = timer_read() | 1;
+        combo_visits         = 0;
+        process_combo(key.code, &record);
+        record.event.pressed = false;
+        process_combo(key.code, &record);
+        return combo_visits / 2;
+    };
+
+    /* A+B plus every 50th filler combo contain KC_A */
+    const uint32_t combos_with_a = 1 + (COMBO_COUNT - 1) / 50;
+    uint32_t       non_combo     = visits(key_c);
+    uint32_t       combo         = visits(key_a);
+    testing::Mock::VerifyAndClearExpectations(&driver);
+
+#ifdef COMBO_KEY_INDEX_SIZE
+    EXPECT_EQ(non_combo, 0);
+    EXPECT_EQ(combo, combos_with_a);
+#else
+    EXPECT_EQ(non_combo, COMBO_COUNT);
+    EXPECT_EQ(combo, COMBO_COUNT);
+#endif
+}
+
+/* Times process_combo() alone for key events that are in no combo, and for
+ * KC_A, which is in a handful of them, against one walk over the keys of
+ * every combo, the least a linear scan can do. Timings vary by host, so they
+ * are only printed; CombosVisitedPerKey checks the work done. */
+TEST_F(Combo, Benchmark) {
+    TestDriver driver;
+    auto       key_a = KeymapKey(0, 0, 0, KC_A);
+    auto       key_c = KeymapKey(0, 2, 0, KC_C);
+
+    set_keymap({key_a, key_c});
+
+    EXPECT_CALL(driver, send_keyboard_mock(_)).Times(AnyNumber());
+
+    auto time_events = [](KeymapKey& key) {
+        keyrecord_t record = {};
+        record.event.key   = key.position;
+        return best_ns_per_event([&](int i) {
+            record.event.pressed = !(i & 1);
+            record.event.time    = timer_read() | 1;
+            process_combo(key.code, &record);
+        });
+    };
+
+    volatile uint16_t sink = 0;
+    double            scan = best_ns_per_event([&](int) {
+        for (uint16_t c = 0; c < COMBO_COUNT; c++) {
+            for (const uint16_t* keys = key_combos[c].keys; *keys != COMBO_END; keys++) {
+                sink = sink + (*keys == KC_C);
+            }
+        }
+    });
+
+    double non_combo = time_events(key_c);
+    double combo     = time_events(key_a);
+    printf("%d combos, ns per process_combo(): non-combo key %.0f, combo key %.0f, walk over all combo keys %.0f\n", COMBO_COUNT, non_combo, combo, scan);
+    testing::Mock::VerifyAndClearExpectations(&driver);
+}
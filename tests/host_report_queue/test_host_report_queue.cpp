@@ -0,0 +1,166 @@
+/* Copyright 2022 QMK
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "gtest/gtest.h"
+#include "keyboard_report_util.hpp"
+#include "test_common.hpp"
+
+using testing::_;
+using testing::AllOf;
+using testing::Field;
+using testing::InSequence;
+
+class HostReportQueue : public TestFixture {
+   protected:
+    host_report_stats_t stats_before;
+
+    void SetUp() override {
+        /* Start on a fresh host frame, so the first report goes out straight away. */
+        TestDriver driver;
+        idle_for(1);
+        stats_before = host_report_get_stats();
+    }
+
+    uint32_t sent() { return host_report_get_stats().sent - stats_before.sent; }
+    uint32_t merged() { return host_report_get_stats().merged - stats_before.merged; }
+    uint32_t dropped() { return host_report_get_stats().dropped - stats_before.dropped; }
+};
+
+TEST_F(HostReportQueue, ChangesWithinAFrameAreMerged) {
+    TestDriver driver;
+    InSequence s;
+
+    EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_A)));
+    register_code(KC_A);
+    testing::Mock::VerifyAndClearExpectations(&driver);
+
+    /* The host already has a report for this frame, so these wait and fold into one. */
+    EXPECT_CALL(driver, send_keyboard_mock(_)).Times(0);
+    register_code(KC_B);
+    register_code(KC_C);
+    run_one_scan_loop();
+    testing::Mock::VerifyAndClearExpectations(&driver);
+
+    EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_A, KC_B, KC_C)));
+    run_one_scan_loop();
+    testing::Mock::VerifyAndClearExpectations(&driver);
+
+    EXPECT_EQ(sent(), 2u);
+    EXPECT_EQ(merged(), 1u);
+    EXPECT_EQ(dropped(), 0u);
+
+    EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_B, KC_C)));
+    EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport()));
+    unregister_code(KC_A);
+    unregister_code(KC_B);
+    unregister_code(KC_C);
+    idle_for(2);
+    testing::Mock::VerifyAndClearExpectations(&driver);
+}
+
+TEST_F(HostReportQueue, TapWithinAFrameIsKept) {
+    TestDriver driver;
+    InSequence s;
+
+    EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_A)));
+    register_code(KC_A);
+    unregister_code(KC_A);
+    register_code(KC_A);
+    /* Adds to the state of the last queued report, so joins it. */
+    register_code(KC_B);
+    testing::Mock::VerifyAndClearExpectations(&driver);
+
+    EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport()));
+    EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_A, KC_B)));
+    idle_for(3);
+    testing::Mock::VerifyAndClearExpectations(&driver);
+
+    EXPECT_EQ(sent(), 3u);
+    EXPECT_EQ(merged(), 1u);
+    EXPECT_EQ(dropped(), 0u);
+
+    EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_B)));
+    EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport()));
+    unregister_code(KC_A);
+    unregister_code(KC_B);
+    idle_for(2);
+    testing::Mock::VerifyAndClearExpectations(&driver);
+}
+
+TEST_F(HostReportQueue, FullQueueKeepsTheLatestState) {
+    TestDriver driver;
+    InSequence s;
+
+    EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_A)));
+    register_code(KC_A);
+    unregister_code(KC_A);
+    register_code(KC_A);
+    /* Neither queued report can take this without hiding a transition, and the queue is full. */
+    register_code(KC_LEFT_SHIFT);
+    unregister_code(KC_A);
+    testing::Mock::VerifyAndClearExpectations(&driver);
+
+    EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport()));
+    EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_LEFT_SHIFT)));
+    idle_for(3);
+    testing::Mock::VerifyAndClearExpectations(&driver);
+
+    EXPECT_EQ(sent(), 3u);
+    EXPECT_EQ(merged(), 1u);
+    EXPECT_EQ(dropped(), 1u);
+
+    EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport()));
+    unregister_code(KC_LEFT_SHIFT);
+    idle_for(2);
+    testing::Mock::VerifyAndClearExpectations(&driver);
+}
+
+TEST_F(HostReportQueue, MouseMovementIsSummed) {
+    TestDriver driver;
+    InSequence s;
+    report_mouse_t report = {};
+
+    EXPECT_CALL(driver, send_mouse_mock(AllOf(Field(&report_mouse_t::x, 10), Field(&report_mouse_t::y, 0))));
+    report.x = 10;
+    host_mouse_send(&report);
+    testing::Mock::VerifyAndClearExpectations(&driver);
+
+    EXPECT_CALL(driver, send_mouse_mock(AllOf(Field(&report_mouse_t::x, 25), Field(&report_mouse_t::y, -5))));
+    report.x = 20;
+    host_mouse_send(&report);
+    report.x = 5;
+    report.y = -5;
+    host_mouse_send(&report);
+    idle_for(2);
+    testing::Mock::VerifyAndClearExpectations(&driver);
+
+    /* A button change is never folded into movement. */
+    EXPECT_CALL(driver, send_mouse_mock(Field(&report_mouse_t::buttons, 0)));
+    EXPECT_CALL(driver, send_mouse_mock(Field(&report_mouse_t::buttons, 1)));
+    report = (report_mouse_t){};
+    report.x = 1;
+    host_mouse_send(&report);
+    report.buttons = 1;
+    host_mouse_send(&report);
+    idle_for(3);
+    testing::Mock::VerifyAndClearExpectations(&driver);
+
+    EXPECT_CALL(driver, send_mouse_mock(Field(&report_mouse_t::buttons, 0)));
+    report = (report_mouse_t){};
+    host_mouse_send(&report);
+    idle_for(2);
+    testing::Mock::VerifyAndClearExpectations(&driver);
+}
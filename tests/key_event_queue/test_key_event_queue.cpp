@@ -0,0 +1,111 @@
+/* Copyright 2022 QMK
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <vector>
+#include "gtest/gtest.h"
+#include "keyboard_report_util.hpp"
+#include "test_common.hpp"
+
+using testing::_;
+using testing::InSequence;
+
+static std::vector<keyevent_t> processed_events;
+
+extern "C" bool process_record_user(uint16_t keycode, keyrecord_t *record) {
+    processed_events.push_back(record->event);
+    return true;
+}
+
+class KeyEventQueue : public TestFixture {
+   protected:
+    void SetUp() override { processed_events.clear(); }
+};
+
+TEST_F(KeyEventQueue, ChordIsProcessedInOneScan) {
+    TestDriver driver;
+    InSequence s;
+    auto       key_a = KeymapKey(0, 0, 0, KC_A);
+    auto       key_b = KeymapKey(0, 3, 0, KC_B);
+    auto       key_c = KeymapKey(0, 1, 2, KC_C);
+
+    set_keymap({key_a, key_b, key_c});
+
+    EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_A)));
+    EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_A, KC_B)));
+    EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_A, KC_B, KC_C)));
+    key_a.press();
+    key_b.press();
+    key_c.press();
+    keyboard_task();
+    testing::Mock::VerifyAndClearExpectations(&driver);
+
+    EXPECT_EQ(key_event_queue_last_count(), 3);
+    ASSERT_EQ(processed_events.size(), 3u);
+    /* Matrix order, all stamped with the time of the scan. */
+    EXPECT_TRUE(KEYEQ(processed_events[0].key, key_a.position));
+    EXPECT_TRUE(KEYEQ(processed_events[1].key, key_b.position));
+    EXPECT_TRUE(KEYEQ(processed_events[2].key, key_c.position));
+    EXPECT_EQ(processed_events[0].time, processed_events[2].time);
+
+    EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_B, KC_C)));
+    EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_C)));
+    EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport()));
+    key_a.release();
+    key_b.release();
+    key_c.release();
+    keyboard_task();
+    testing::Mock::VerifyAndClearExpectations(&driver);
+
+    EXPECT_EQ(key_event_queue_last_count(), 3);
+    EXPECT_GE(key_event_queue_high_water_mark(), 3);
+}
+
+TEST_F(KeyEventQueue, OverflowIsDeferredToNextScan) {
+    TestDriver driver;
+    auto       key_a = KeymapKey(0, 0, 0, KC_A);
+    auto       key_b = KeymapKey(0, 1, 0, KC_B);
+    auto       key_c = KeymapKey(0, 2, 0, KC_C);
+    auto       key_d = KeymapKey(0, 3, 0, KC_D);
+    auto       key_e = KeymapKey(0, 4, 0, KC_E);
+
+    set_keymap({key_a, key_b, key_c, key_d, key_e});
+
+    EXPECT_CALL(driver, send_keyboard_mock(_)).Times(4);
+    key_a.press();
+    key_b.press();
+    key_c.press();
+    key_d.press();
+    key_e.press();
+    run_one_scan_loop();
+    testing::Mock::VerifyAndClearExpectations(&driver);
+    EXPECT_EQ(key_event_queue_last_count(), 4);
+    EXPECT_EQ(key_event_queue_high_water_mark(), 4);
+
+    EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_A, KC_B, KC_C, KC_D, KC_E)));
+    run_one_scan_loop();
+    testing::Mock::VerifyAndClearExpectations(&driver);
+    EXPECT_EQ(key_event_queue_last_count(), 1);
+
+    EXPECT_CALL(driver, send_keyboard_mock(_)).Times(5);
+    key_a.release();
+    key_b.release();
+    key_c.release();
+    key_d.release();
+    key_e.release();
+    run_one_scan_loop();
+    run_one_scan_loop();
+    testing::Mock::VerifyAndClearExpectations(&driver);
+}
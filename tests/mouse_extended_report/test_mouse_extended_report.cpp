@@ -0,0 +1,98 @@
+/* Copyright 2022 QMK
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "gtest/gtest.h"
+#include "keyboard_report_util.hpp"
+#include "test_pointing_device.hpp"
+
+using testing::_;
+using testing::AllOf;
+using testing::Field;
+using testing::InSequence;
+
+class MouseExtendedReport : public TestFixture {
+   protected:
+    void TearDown() override {
+        mouse_protocol              = 1;
+        mouse_resolution_multiplier = 0;
+    }
+};
+
+TEST_F(MouseExtendedReport, LargeMovementFitsInOneReport) {
+    TestDriver driver;
+    InSequence s;
+
+    EXPECT_CALL(driver, send_mouse_mock(AllOf(Field(&report_mouse_t::x, 1000), Field(&report_mouse_t::y, -300), Field(&report_mouse_t::boot_x, 127), Field(&report_mouse_t::boot_y, -127))));
+    test_sensor.x = 1000;
+    test_sensor.y = -300;
+    run_one_scan_loop();
+    testing::Mock::VerifyAndClearExpectations(&driver);
+
+    EXPECT_CALL(driver, send_mouse_mock(_)).Times(0);
+    run_one_scan_loop();
+    testing::Mock::VerifyAndClearExpectations(&driver);
+}
+
+TEST_F(MouseExtendedReport, BootProtocolSplitsLargeMovement) {
+    TestDriver driver;
+    InSequence s;
+
+    mouse_protocol = 0;
+    EXPECT_CALL(driver, send_mouse_mock(AllOf(Field(&report_mouse_t::boot_x, 127), Field(&report_mouse_t::boot_y, -20))));
+    EXPECT_CALL(driver, send_mouse_mock(AllOf(Field(&report_mouse_t::boot_x, 127), Field(&report_mouse_t::boot_y, 0))));
+    EXPECT_CALL(driver, send_mouse_mock(AllOf(Field(&report_mouse_t::boot_x, 46), Field(&report_mouse_t::boot_y, 0))));
+    test_sensor.x = 300;
+    test_sensor.y = -20;
+    run_one_scan_loop();
+    run_one_scan_loop();
+    run_one_scan_loop();
+    testing::Mock::VerifyAndClearExpectations(&driver);
+
+    EXPECT_CALL(driver, send_mouse_mock(_)).Times(0);
+    run_one_scan_loop();
+    testing::Mock::VerifyAndClearExpectations(&driver);
+}
+
+TEST_F(MouseExtendedReport, WheelKeysScrollWholeNotches) {
+    TestDriver driver;
+    auto       key = KeymapKey(0, 0, 0, KC_MS_WH_UP);
+
+    set_keymap({key});
+
+    /* Until the host enables the Resolution Multiplier, one unit is one notch. */
+    EXPECT_EQ(host_mouse_scroll_resolution(), 1);
+    EXPECT_CALL(driver, send_mouse_mock(Field(&report_mouse_t::v, 1)));
+    key.press();
+    run_one_scan_loop();
+    testing::Mock::VerifyAndClearExpectations(&driver);
+
+    EXPECT_CALL(driver, send_mouse_mock(Field(&report_mouse_t::v, 0)));
+    key.release();
+    run_one_scan_loop();
+    testing::Mock::VerifyAndClearExpectations(&driver);
+
+    mouse_resolution_multiplier = 1;
+    EXPECT_EQ(host_mouse_scroll_resolution(), POINTING_DEVICE_HIRES_SCROLL_MULTIPLIER);
+    EXPECT_CALL(driver, send_mouse_mock(Field(&report_mouse_t::v, POINTING_DEVICE_HIRES_SCROLL_MULTIPLIER)));
+    key.press();
+    run_one_scan_loop();
+    testing::Mock::VerifyAndClearExpectations(&driver);
+
+    EXPECT_CALL(driver, send_mouse_mock(Field(&report_mouse_t::v, 0)));
+    key.release();
+    run_one_scan_loop();
+    testing::Mock::VerifyAndClearExpectations(&driver);
+}
@@ -0,0 +1,155 @@
+/* Copyright 2022 QMK
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <vector>
+#include "gtest/gtest.h"
+#include "keyboard_report_util.hpp"
+#include "test_pointing_device.hpp"
+
+using testing::_;
+using testing::Invoke;
+
+struct motion_t {
+    int8_t x;
+    int8_t y;
+};
+
+class PointingDeviceAccel : public TestFixture {
+   protected:
+    std::vector<report_mouse_t> reports;
+
+    void SetUp() override {
+        pointing_device_accel_reset();
+    }
+
+    void TearDown() override {
+        pointing_device_accel_set_enabled(true);
+        pointing_device_accel_set_drag_scroll(false);
+        pointing_device_accel_set_scale(POINTING_DEVICE_ACCEL_SCALE);
+    }
+
+    /* Plays one sensor reading per ms, then a few idle ms, and collects the reports sent. */
+    void play(TestDriver &driver, const std::vector<motion_t> &trace) {
+        EXPECT_CALL(driver, send_mouse_mock(_)).WillRepeatedly(Invoke([this](report_mouse_t &report) { reports.push_back(report); }));
+        /* Starts on a new ms, as movement is processed once per ms. */
+        run_one_scan_loop();
+        for (auto motion : trace) {
+            test_sensor.x = motion.x;
+            test_sensor.y = motion.y;
+            run_one_scan_loop();
+        }
+        idle_for(10);
+        testing::Mock::VerifyAndClearExpectations(&driver);
+    }
+
+    int32_t sum_x() {
+        int32_t sum = 0;
+        for (auto &report : reports) sum += report.x;
+        return sum;
+    }
+
+    int32_t sum_y() {
+        int32_t sum = 0;
+        for (auto &report : reports) sum += report.y;
+        return sum;
+    }
+};
+
+TEST_F(PointingDeviceAccel, SlowMovementIsNotAccelerated) {
+    TestDriver driver;
+
+    play(driver, std::vector<motion_t>(10, {1, -1}));
+    ASSERT_EQ(reports.size(), 10);
+    for (auto &report : reports) {
+        EXPECT_EQ(report.x, 1);
+        EXPECT_EQ(report.y, -1);
+    }
+}
+
+TEST_F(PointingDeviceAccel, FastMovementFollowsTheCurve) {
+    TestDriver driver;
+
+    /* 10 counts per ms is the sixth point of the default curve, a gain of 2. */
+    play(driver, std::vector<motion_t>(5, {10, 0}));
+    ASSERT_EQ(reports.size(), 5);
+    for (auto &report : reports) {
+        EXPECT_EQ(report.x, 20);
+    }
+}
+
+TEST_F(PointingDeviceAccel, GainIsInterpolatedBetweenPoints) {
+    TestDriver driver;
+
+    /* 7 counts per ms falls halfway between the gains of 1.5 and 1.75, and fractions are carried. */
+    play(driver, std::vector<motion_t>(8, {0, 7}));
+    EXPECT_EQ(reports[0].y, 11);
+    EXPECT_EQ(reports[1].y, 11);
+    EXPECT_EQ(reports[2].y, 12);
+    EXPECT_EQ(sum_y(), 91);
+}
+
+TEST_F(PointingDeviceAccel, RecordedTraceIsUnchangedWhenDisabled) {
+    TestDriver driver;
+    /* A flick: speeding up, then slowing down with a change of direction. */
+    std::vector<motion_t> trace = {{1, 0}, {3, 1}, {8, 2}, {20, 5}, {45, 9}, {60, 12}, {38, 6}, {17, 1}, {6, -2}, {2, -1}, {1, -1}};
+
+    pointing_device_accel_set_enabled(false);
+    play(driver, trace);
+    ASSERT_EQ(reports.size(), trace.size());
+    for (size_t i = 0; i < trace.size(); i++) {
+        EXPECT_EQ(reports[i].x, trace[i].x);
+        EXPECT_EQ(reports[i].y, trace[i].y);
+    }
+}
+
+TEST_F(PointingDeviceAccel, RecordedTraceIsAcceleratedWhenFast) {
+    TestDriver driver;
+    std::vector<motion_t> trace = {{1, 0}, {3, 1}, {8, 2}, {20, 5}, {45, 9}, {60, 12}, {38, 6}, {17, 1}, {6, -2}, {2, -1}, {1, -1}};
+
+    play(driver, trace);
+    /* The slow start goes through as it is, the fast part is sped up up to four times. */
+    EXPECT_EQ(reports[0].x, 1);
+    EXPECT_EQ(reports[1].x, 3);
+    EXPECT_GT(sum_x(), 201 * 3);
+    EXPECT_LE(sum_x(), 201 * 4);
+}
+
+TEST_F(PointingDeviceAccel, ScaleIsAppliedBeforeTheCurve) {
+    TestDriver driver;
+
+    pointing_device_accel_set_enabled(false);
+    pointing_device_accel_set_scale(128);
+    play(driver, std::vector<motion_t>(4, {3, 0}));
+    ASSERT_EQ(reports.size(), 4);
+    EXPECT_EQ(reports[0].x, 1);
+    EXPECT_EQ(reports[1].x, 2);
+    EXPECT_EQ(reports[2].x, 1);
+    EXPECT_EQ(reports[3].x, 2);
+}
+
+TEST_F(PointingDeviceAccel, DragScrollTurnsMovementIntoScrolling) {
+    TestDriver driver;
+
+    pointing_device_accel_set_drag_scroll(true);
+    play(driver, std::vector<motion_t>(4, {8, 16}));
+    ASSERT_EQ(reports.size(), 4);
+    for (auto &report : reports) {
+        EXPECT_EQ(report.x, 0);
+        EXPECT_EQ(report.y, 0);
+        EXPECT_EQ(report.h, 1);
+        EXPECT_EQ(report.v, -2);
+    }
+}
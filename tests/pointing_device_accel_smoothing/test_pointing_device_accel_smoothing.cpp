@@ -0,0 +1,72 @@
+/* Copyright 2022 QMK
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "gtest/gtest.h"
+#include "keyboard_report_util.hpp"
+#include "test_pointing_device.hpp"
+
+using testing::_;
+using testing::Field;
+using testing::InSequence;
+
+class PointingDeviceAccelSmoothing : public TestFixture {
+   protected:
+    void SetUp() override {
+        pointing_device_accel_reset();
+        pointing_device_accel_set_enabled(false);
+    }
+
+    void TearDown() override {
+        pointing_device_accel_set_enabled(true);
+    }
+};
+
+TEST_F(PointingDeviceAccelSmoothing, JumpIsSpreadOverTheFollowingReports) {
+    TestDriver driver;
+    InSequence s;
+
+    EXPECT_CALL(driver, send_mouse_mock(Field(&report_mouse_t::x, 32)));
+    EXPECT_CALL(driver, send_mouse_mock(Field(&report_mouse_t::x, 16)));
+    EXPECT_CALL(driver, send_mouse_mock(Field(&report_mouse_t::x, 8)));
+    EXPECT_CALL(driver, send_mouse_mock(Field(&report_mouse_t::x, 4)));
+    EXPECT_CALL(driver, send_mouse_mock(Field(&report_mouse_t::x, 2)));
+    EXPECT_CALL(driver, send_mouse_mock(Field(&report_mouse_t::x, 1)));
+    run_one_scan_loop();
+    test_sensor.x = 64;
+    idle_for(20);
+    testing::Mock::VerifyAndClearExpectations(&driver);
+}
+
+TEST_F(PointingDeviceAccelSmoothing, SteadyMovementIsUnchanged) {
+    TestDriver driver;
+    InSequence s;
+
+    /* The filter catches up within a few ms, after which every report carries the full movement. */
+    EXPECT_CALL(driver, send_mouse_mock(Field(&report_mouse_t::x, 4)));
+    EXPECT_CALL(driver, send_mouse_mock(Field(&report_mouse_t::x, 6)));
+    EXPECT_CALL(driver, send_mouse_mock(Field(&report_mouse_t::x, 7))).Times(2);
+    EXPECT_CALL(driver, send_mouse_mock(Field(&report_mouse_t::x, 8))).Times(6);
+    run_one_scan_loop();
+    for (int i = 0; i < 10; i++) {
+        test_sensor.x = 8;
+        run_one_scan_loop();
+    }
+    testing::Mock::VerifyAndClearExpectations(&driver);
+
+    EXPECT_CALL(driver, send_mouse_mock(_)).Times(testing::AnyNumber());
+    idle_for(20);
+    testing::Mock::VerifyAndClearExpectations(&driver);
+}
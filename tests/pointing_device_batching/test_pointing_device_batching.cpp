@@ -0,0 +1,126 @@
+/* Copyright 2022 QMK
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "gtest/gtest.h"
+#include "keyboard_report_util.hpp"
+#include "test_pointing_device.hpp"
+
+using testing::_;
+using testing::AllOf;
+using testing::Field;
+using testing::InSequence;
+
+/* Whether the fake host has collected the last report. */
+static bool mouse_ready = true;
+
+extern "C" bool host_mouse_ready(void) { return mouse_ready; }
+
+class PointingDeviceBatching : public TestFixture {
+   protected:
+    void TearDown() override {
+        mouse_ready = true;
+    }
+};
+
+TEST_F(PointingDeviceBatching, SensorIsReadOnceTheHostIsReady) {
+    TestDriver driver;
+    InSequence s;
+
+    mouse_ready       = false;
+    test_sensor.reads = 0;
+    EXPECT_CALL(driver, send_mouse_mock(_)).Times(0);
+    for (int i = 0; i < 5; i++) {
+        test_sensor.x += 10;
+        test_sensor.v += 1;
+        run_one_scan_loop();
+    }
+    testing::Mock::VerifyAndClearExpectations(&driver);
+    EXPECT_EQ(test_sensor.reads, 0);
+
+    mouse_ready = true;
+    EXPECT_CALL(driver, send_mouse_mock(AllOf(Field(&report_mouse_t::x, 50), Field(&report_mouse_t::v, 5))));
+    run_one_scan_loop();
+    testing::Mock::VerifyAndClearExpectations(&driver);
+    EXPECT_EQ(test_sensor.reads, 1);
+
+    EXPECT_CALL(driver, send_mouse_mock(_)).Times(0);
+    run_one_scan_loop();
+    testing::Mock::VerifyAndClearExpectations(&driver);
+}
+
+TEST_F(PointingDeviceBatching, HeldMovementIsSplitToFitReports) {
+    TestDriver driver;
+    InSequence s;
+
+    report_mouse_t report = {};
+
+    mouse_ready = false;
+    report.x    = 100;
+    for (int i = 0; i < 3; i++) {
+        pointing_device_set_report(report);
+        pointing_device_send();
+    }
+
+    mouse_ready = true;
+    EXPECT_CALL(driver, send_mouse_mock(Field(&report_mouse_t::x, 127)));
+    EXPECT_CALL(driver, send_mouse_mock(Field(&report_mouse_t::x, 127)));
+    EXPECT_CALL(driver, send_mouse_mock(Field(&report_mouse_t::x, 46)));
+    run_one_scan_loop();
+    run_one_scan_loop();
+    run_one_scan_loop();
+    testing::Mock::VerifyAndClearExpectations(&driver);
+}
+
+TEST_F(PointingDeviceBatching, ButtonChangesWaitForTheHost) {
+    TestDriver driver;
+    InSequence s;
+
+    EXPECT_CALL(driver, send_mouse_mock(_)).Times(0);
+    mouse_ready         = false;
+    test_sensor.x       = 20;
+    test_sensor.buttons = 1;
+    run_one_scan_loop();
+    testing::Mock::VerifyAndClearExpectations(&driver);
+
+    mouse_ready = true;
+    EXPECT_CALL(driver, send_mouse_mock(AllOf(Field(&report_mouse_t::buttons, 1), Field(&report_mouse_t::x, 20))));
+    run_one_scan_loop();
+    testing::Mock::VerifyAndClearExpectations(&driver);
+
+    EXPECT_CALL(driver, send_mouse_mock(AllOf(Field(&report_mouse_t::buttons, 0), Field(&report_mouse_t::x, 0))));
+    test_sensor.buttons = 0;
+    run_one_scan_loop();
+    testing::Mock::VerifyAndClearExpectations(&driver);
+}
+
+TEST_F(PointingDeviceBatching, SentReportsAreHeldUntilTheHostIsReady) {
+    TestDriver     driver;
+    InSequence     s;
+    report_mouse_t report = {};
+
+    mouse_ready    = false;
+    report.x       = 30;
+    report.buttons = 1;
+    EXPECT_CALL(driver, send_mouse_mock(_)).Times(0);
+    pointing_device_set_report(report);
+    pointing_device_send();
+    testing::Mock::VerifyAndClearExpectations(&driver);
+
+    mouse_ready = true;
+    EXPECT_CALL(driver, send_mouse_mock(AllOf(Field(&report_mouse_t::buttons, 1), Field(&report_mouse_t::x, 30))));
+    pointing_device_send();
+    testing::Mock::VerifyAndClearExpectations(&driver);
+}
@@ -0,0 +1,155 @@
+/* Copyright 2022 QMK
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "gtest/gtest.h"
+#include "keyboard_report_util.hpp"
+#include "test_common.hpp"
+
+using testing::_;
+
+class ResolvedLayersCache : public TestFixture {
+   protected:
+    /* The uncached top-down walk, as a reference. */
+    uint8_t reference_layer(keypos_t key) {
+        layer_state_t layers = layer_state | default_layer_state;
+        for (int8_t i = MAX_LAYER - 1; i >= 0; i--) {
+            if ((layers & ((layer_state_t)1 << i)) && action_for_key(i, key).code != ACTION_TRANSPARENT) {
+                return i;
+            }
+        }
+        return 0;
+    }
+};
+
+TEST_F(ResolvedLayersCache, ResolvesThroughTransparentKeys) {
+    TestDriver driver;
+    keypos_t   key = {.col = 1, .row = 0};
+
+    set_keymap({KeymapKey{0, 1, 0, KC_A}, KeymapKey{1, 1, 0, KC_TRNS}, KeymapKey{2, 1, 0, KC_C}, KeymapKey{3, 1, 0, KC_TRNS}});
+
+    EXPECT_EQ(layer_switch_get_layer(key), 0);
+    layer_on(1);
+    EXPECT_EQ(layer_switch_get_layer(key), 0);
+    layer_on(3);
+    EXPECT_EQ(layer_switch_get_layer(key), 0);
+    layer_on(2);
+    EXPECT_EQ(layer_switch_get_layer(key), 2);
+    layer_off(3);
+    EXPECT_EQ(layer_switch_get_layer(key), 2);
+    layer_off(2);
+    EXPECT_EQ(layer_switch_get_layer(key), 0);
+
+    testing::Mock::VerifyAndClearExpectations(&driver);
+}
+
+TEST_F(ResolvedLayersCache, FollowsDefaultLayer) {
+    TestDriver driver;
+    keypos_t   key = {.col = 1, .row = 0};
+
+    set_keymap({KeymapKey{0, 1, 0, KC_A}, KeymapKey{1, 1, 0, KC_B}, KeymapKey{2, 1, 0, KC_TRNS}});
+
+    default_layer_set((layer_state_t)1 << 1);
+    EXPECT_EQ(layer_switch_get_layer(key), 1);
+    layer_on(2);
+    EXPECT_EQ(layer_switch_get_layer(key), 1);
+    default_layer_set((layer_state_t)1 << 0);
+    EXPECT_EQ(layer_switch_get_layer(key), 0);
+
+    testing::Mock::VerifyAndClearExpectations(&driver);
+}
+
+TEST_F(ResolvedLayersCache, MatchesReferenceWalk) {
+    TestDriver driver;
+    const int  layers = 8;
+
+    /* Deterministic mix of transparent and opaque keys on every layer. */
+    uint32_t seed = 12345;
+    for (uint8_t layer = 0; layer < layers; layer++) {
+        for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+            for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+                seed = seed * 1103515245 + 12345;
+                add_key(KeymapKey{layer, col, row, ((seed >> 16) % 3) ? KC_TRNS : (uint16_t)(KC_A + layer)});
+            }
+        }
+    }
+
+    for (int i = 0; i < 500; i++) {
+        seed = seed * 1103515245 + 12345;
+        layer_state_t state = (seed >> 8) & ((1 << layers) - 1);
+        switch ((seed >> 20) % 4) {
+            case 0:
+                layer_state_set(state);
+                break;
+            case 1:
+                layer_invert((seed >> 24) % layers);
+                break;
+            case 2:
+                /* Written directly, bypassing layer_state_set() */
+                layer_state = state;
+                break;
+            case 3:
+                default_layer_set((layer_state_t)1 << ((seed >> 24) % 2));
+                break;
+        }
+        for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+            for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+                keypos_t key = {.col = col, .row = row};
+                ASSERT_EQ(layer_switch_get_layer(key), reference_layer(key)) << "layers " << (layer_state | default_layer_state) << " key " << +col << "," << +row;
+            }
+        }
+    }
+
+    default_layer_set(1);
+    testing::Mock::VerifyAndClearExpectations(&driver);
+}
+
+TEST_F(ResolvedLayersCache, MomentaryLayerWithKeypress) {
+    TestDriver driver;
+    KeymapKey  layer_key   = KeymapKey{0, 0, 0, MO(1)};
+    KeymapKey  regular_key = KeymapKey{0, 1, 0, KC_A};
+    set_keymap({layer_key, regular_key, KeymapKey{1, 1, 0, KC_B}});
+
+    EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_A))).Times(1);
+    regular_key.press();
+    run_one_scan_loop();
+    testing::Mock::VerifyAndClearExpectations(&driver);
+
+    EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport())).Times(1);
+    regular_key.release();
+    run_one_scan_loop();
+    testing::Mock::VerifyAndClearExpectations(&driver);
+
+    EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport())).Times(1);
+    layer_key.press();
+    run_one_scan_loop();
+    testing::Mock::VerifyAndClearExpectations(&driver);
+
+    EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_B))).Times(1);
+    regular_key.press();
+    run_one_scan_loop();
+    testing::Mock::VerifyAndClearExpectations(&driver);
+
+    EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport())).Times(1);
+    regular_key.release();
+    run_one_scan_loop();
+    testing::Mock::VerifyAndClearExpectations(&driver);
+
+    EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport())).Times(1);
+    layer_key.release();
+    run_one_scan_loop();
+    EXPECT_TRUE(layer_state_is(0));
+    testing::Mock::VerifyAndClearExpectations(&driver);
+}
@@ -0,0 +1,198 @@
+/* Copyright 2022 QMK
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include "gtest/gtest.h"
+#include "test_rgb_matrix.hpp"
+
+#if defined(__x86_64__) || defined(__i386__)
+#    include <x86intrin.h>
+static uint64_t    benchmark_ticks() { return __rdtsc(); }
+static const char *benchmark_unit = "cycles";
+#else
+static uint64_t    benchmark_ticks() { return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count(); }
+static const char *benchmark_unit = "ns";
+#endif
+
+extern "C" void advance_time(uint32_t ms);
+
+/* Every colour conversion the effects make, counted so each effect's work can be checked on any host. */
+static uint32_t conversion_calls = 0;
+
+extern "C" RGB rgb_matrix_hsv_to_rgb(HSV hsv) {
+    conversion_calls++;
+    return hsv_to_rgb(hsv);
+}
+
+/* A 20 by 5 grid spread over the usual 224 by 64 area, with the first ten LEDs of each of the top four rows under keys. */
+#define BENCHMARK_GRID_COLS 20
+
+static led_config_t benchmark_layout() {
+    led_config_t layout = {};
+
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            uint8_t led                = row * BENCHMARK_GRID_COLS + col;
+            layout.matrix_co[row][col] = led < DRIVER_LED_TOTAL ? led : NO_LED;
+        }
+    }
+    for (uint8_t i = 0; i < DRIVER_LED_TOTAL; i++) {
+        uint8_t rows    = (DRIVER_LED_TOTAL + BENCHMARK_GRID_COLS - 1) / BENCHMARK_GRID_COLS;
+        uint8_t col     = i % BENCHMARK_GRID_COLS;
+        uint8_t row     = i / BENCHMARK_GRID_COLS;
+        layout.point[i] = {(uint8_t)(col * 224 / (BENCHMARK_GRID_COLS - 1)), (uint8_t)(rows > 1 ? row * 64 / (rows - 1) : 32)};
+        layout.flags[i] = col < MATRIX_COLS && row < MATRIX_ROWS ? LED_FLAG_KEYLIGHT : LED_FLAG_UNDERGLOW;
+    }
+    return layout;
+}
+
+led_config_t g_led_config = benchmark_layout();
+
+static const char *effect_names[] = {
+    "NONE",
+#define RGB_MATRIX_EFFECT(name, ...) #name,
+#include "rgb_matrix_effects.inc"
+#undef RGB_MATRIX_EFFECT
+};
+
+/* Most an effect should cost, in the time of a colour conversion (rgb_matrix_hsv_to_rgb) per LED per frame. Timings
+ * depend on the host, so going over is only reported; the asserted budget is the number of conversions made. */
+struct effect_budget_t {
+    uint8_t mode;
+    double  conversions;
+};
+
+// clang-format off
+static const effect_budget_t effect_budgets[] = {
+    {RGB_MATRIX_SOLID_COLOR,                   1.0},
+    {RGB_MATRIX_ALPHAS_MODS,                   1.0},
+    {RGB_MATRIX_GRADIENT_UP_DOWN,              3.5},
+    {RGB_MATRIX_GRADIENT_LEFT_RIGHT,           2.0},
+    {RGB_MATRIX_BREATHING,                     1.0},
+    {RGB_MATRIX_BAND_SAT,                      3.5},
+    {RGB_MATRIX_BAND_VAL,                      2.5},
+    {RGB_MATRIX_BAND_PINWHEEL_SAT,             4.0},
+    {RGB_MATRIX_BAND_PINWHEEL_VAL,             2.5},
+    {RGB_MATRIX_BAND_SPIRAL_SAT,               4.5},
+    {RGB_MATRIX_BAND_SPIRAL_VAL,               3.5},
+    {RGB_MATRIX_CYCLE_ALL,                     3.5},
+    {RGB_MATRIX_CYCLE_LEFT_RIGHT,              3.5},
+    {RGB_MATRIX_CYCLE_UP_DOWN,                 3.5},
+    {RGB_MATRIX_RAINBOW_MOVING_CHEVRON,        3.5},
+    {RGB_MATRIX_CYCLE_OUT_IN,                  4.5},
+    {RGB_MATRIX_CYCLE_OUT_IN_DUAL,             4.0},
+    {RGB_MATRIX_CYCLE_PINWHEEL,                3.5},
+    {RGB_MATRIX_CYCLE_SPIRAL,                  5.0},
+    {RGB_MATRIX_DUAL_BEACON,                   4.0},
+    {RGB_MATRIX_RAINBOW_BEACON,                4.0},
+    {RGB_MATRIX_RAINBOW_PINWHEELS,             4.0},
+    {RGB_MATRIX_RAINDROPS,                     1.0},
+    {RGB_MATRIX_JELLYBEAN_RAINDROPS,           1.0},
+    {RGB_MATRIX_HUE_BREATHING,                 1.0},
+    {RGB_MATRIX_HUE_PENDULUM,                  3.5},
+    {RGB_MATRIX_HUE_WAVE,                      3.5},
+    {RGB_MATRIX_PIXEL_RAIN,                    1.0},
+    {RGB_MATRIX_PIXEL_FRACTAL,                 1.0},
+    {RGB_MATRIX_TYPING_HEATMAP,                2.0},
+    {RGB_MATRIX_DIGITAL_RAIN,                  1.0},
+    {RGB_MATRIX_SOLID_REACTIVE_SIMPLE,         3.0},
+    {RGB_MATRIX_SOLID_REACTIVE,                4.0},
+    {RGB_MATRIX_SOLID_REACTIVE_WIDE,           4.5},
+    {RGB_MATRIX_SOLID_REACTIVE_MULTIWIDE,      4.0},
+    {RGB_MATRIX_SOLID_REACTIVE_CROSS,          4.5},
+    {RGB_MATRIX_SOLID_REACTIVE_MULTICROSS,     5.5},
+    {RGB_MATRIX_SOLID_REACTIVE_NEXUS,          5.0},
+    {RGB_MATRIX_SOLID_REACTIVE_MULTINEXUS,     5.5},
+    {RGB_MATRIX_SPLASH,                        5.0},
+    {RGB_MATRIX_MULTISPLASH,                   8.5},
+    {RGB_MATRIX_SOLID_SPLASH,                  4.5},
+    {RGB_MATRIX_SOLID_MULTISPLASH,             8.0},
+};
+// clang-format on
+
+class RgbMatrixBenchmark : public RgbMatrixTestFixture {
+   protected:
+    /* Best time, over several rounds, to render the given number of frames. */
+    uint64_t render(uint8_t mode, uint32_t frames) {
+        uint64_t best = UINT64_MAX;
+
+        rgb_matrix_mode_noeeprom(mode);
+        for (int round = 0; round < RGB_MATRIX_BENCHMARK_ROUNDS; round++) {
+            uint32_t target = test_rgb_matrix_flushes + frames;
+            uint32_t hits   = 0;
+            uint64_t total  = 0;
+
+            conversion_calls = 0;
+
+            while (test_rgb_matrix_flushes < target) {
+                // Keep the reactive effects busy with a key hit every other frame
+                if ((test_rgb_matrix_flushes & 1) && hits != test_rgb_matrix_flushes) {
+                    hits = test_rgb_matrix_flushes;
+                    process_rgb_matrix(hits % MATRIX_ROWS, (hits * 3) % MATRIX_COLS, true);
+                }
+                uint64_t start = benchmark_ticks();
+                rgb_matrix_task();
+                total += benchmark_ticks() - start;
+                advance_time(RGB_MATRIX_LED_FLUSH_LIMIT);
+            }
+            best = std::min(best, total);
+        }
+        return best;
+    }
+
+    /* Best time for one colour conversion, the unit the budgets are given in. */
+    double conversion_cost() {
+        volatile uint8_t sink = 0;
+        uint64_t         best = UINT64_MAX;
+
+        for (int round = 0; round < RGB_MATRIX_BENCHMARK_ROUNDS; round++) {
+            uint64_t start = benchmark_ticks();
+            for (uint32_t i = 0; i < RGB_MATRIX_BENCHMARK_FRAMES * DRIVER_LED_TOTAL; i++) {
+                HSV hsv = {(uint8_t)i, (uint8_t)(255 - (i >> 3)), (uint8_t)(i * 7)};
+                RGB rgb = rgb_matrix_hsv_to_rgb(hsv);
+                sink    = sink + rgb.r + rgb.g + rgb.b;
+            }
+            best = std::min(best, benchmark_ticks() - start);
+        }
+        return (double)best / (RGB_MATRIX_BENCHMARK_FRAMES * DRIVER_LED_TOTAL);
+    }
+};
+
+TEST_F(RgbMatrixBenchmark, EffectsStayWithinBudget) {
+    double conversion = conversion_cost();
+
+    rgb_matrix_sethsv_noeeprom(HSV_RED);
+
+    std::printf("RGB Matrix benchmark: %d LEDs, %d frames, one conversion = %.1f %s\n", DRIVER_LED_TOTAL, RGB_MATRIX_BENCHMARK_FRAMES, conversion, benchmark_unit);
+    std::printf("%-28s %14s %12s %12s %8s %6s\n", "effect", "per frame", "per LED", "conversions", "budget", "calls");
+    for (uint8_t mode = RGB_MATRIX_SOLID_COLOR; mode < RGB_MATRIX_EFFECT_MAX; mode++) {
+        double per_frame   = (double)render(mode, RGB_MATRIX_BENCHMARK_FRAMES) / RGB_MATRIX_BENCHMARK_FRAMES;
+        double per_led     = per_frame / DRIVER_LED_TOTAL;
+        double conversions = per_led / conversion;
+        double calls       = (double)conversion_calls / (RGB_MATRIX_BENCHMARK_FRAMES * DRIVER_LED_TOTAL);
+        double budget      = 0;
+
+        for (auto &effect_budget : effect_budgets) {
+            if (effect_budget.mode == mode) budget = effect_budget.conversions;
+        }
+        std::printf("%-28s %14.0f %12.1f %12.2f %8.1f %6.2f%s\n", effect_names[mode], per_frame, per_led, conversions, budget, calls, conversions > budget ? "  over budget" : "");
+        EXPECT_GT(budget, 0) << effect_names[mode] << " has no budget";
+        // Each LED is converted at most once per frame
+        EXPECT_LE(conversion_calls, RGB_MATRIX_BENCHMARK_FRAMES * DRIVER_LED_TOTAL) << effect_names[mode] << " converts some LEDs more than once";
+    }
+}
@@ -0,0 +1,69 @@
+/* Copyright 2022 QMK
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "gtest/gtest.h"
+#include "test_rgb_matrix.hpp"
+
+extern "C" RGB rgb_matrix_hsv_to_rgb(HSV hsv);
+
+/* LEDs around the default center of {112, 32}: right, below, left, above, below right and on the center itself. */
+static const led_point_t geometry_points[DRIVER_LED_TOTAL] = {{152, 32}, {112, 62}, {72, 32}, {112, 2}, {142, 62}, {112, 32}};
+
+static led_point_t geometry_point(uint8_t index) { return geometry_points[index]; }
+
+led_config_t g_led_config = test_rgb_matrix_underglow_layout(geometry_point);
+
+class RgbMatrixGeometryCache : public RgbMatrixTestFixture {};
+
+TEST_F(RgbMatrixGeometryCache, CacheHoldsDistanceAndAngleFromCenter) {
+    const led_geometry_t expected[DRIVER_LED_TOTAL] = {{40, 0}, {30, 64}, {40, 128}, {30, 192}, {42, 32}, {0, 0}};
+
+    for (uint8_t i = 0; i < DRIVER_LED_TOTAL; i++) {
+        EXPECT_EQ(g_led_geometry[i].dist, expected[i].dist) << "LED " << (int)i;
+        EXPECT_EQ(g_led_geometry[i].angle, expected[i].angle) << "LED " << (int)i;
+    }
+}
+
+TEST_F(RgbMatrixGeometryCache, UpdateFollowsMovedLeds) {
+    g_led_config.point[0] = {112, 62};
+    rgb_matrix_update_geometry();
+    EXPECT_EQ(g_led_geometry[0].dist, 30);
+    EXPECT_EQ(g_led_geometry[0].angle, 64);
+
+    g_led_config.point[0] = geometry_points[0];
+    rgb_matrix_update_geometry();
+    EXPECT_EQ(g_led_geometry[0].dist, 40);
+    EXPECT_EQ(g_led_geometry[0].angle, 0);
+}
+
+TEST_F(RgbMatrixGeometryCache, SpiralRendersFromCache) {
+    TestDriver driver;
+
+    rgb_matrix_mode_noeeprom(RGB_MATRIX_CYCLE_SPIRAL);
+    rgb_matrix_sethsv_noeeprom(0, 255, 255);
+    // With no speed the spiral stands still, and each hue is the distance less the angle
+    rgb_matrix_set_speed_noeeprom(0);
+    for (int i = 0; i < 10; i++) {
+        run_one_scan_loop();
+    }
+
+    for (uint8_t i = 0; i < DRIVER_LED_TOTAL; i++) {
+        RGB expected = rgb_matrix_hsv_to_rgb({(uint8_t)(g_led_geometry[i].dist - g_led_geometry[i].angle), 255, 255});
+        EXPECT_EQ(test_rgb_matrix_leds[i].r, expected.r) << "LED " << (int)i;
+        EXPECT_EQ(test_rgb_matrix_leds[i].g, expected.g) << "LED " << (int)i;
+        EXPECT_EQ(test_rgb_matrix_leds[i].b, expected.b) << "LED " << (int)i;
+    }
+}
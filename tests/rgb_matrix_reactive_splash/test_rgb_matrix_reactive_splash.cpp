@@ -0,0 +1,141 @@
+/* Copyright 2022 QMK
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <algorithm>
+#include <cstring>
+#include "gtest/gtest.h"
+#include "test_rgb_matrix.hpp"
+
+typedef HSV (*reactive_splash_f)(HSV hsv, int16_t dx, int16_t dy, uint8_t dist, uint16_t tick);
+typedef bool (*reactive_splash_reach_f)(uint16_t tick, uint8_t* inner, uint8_t* outer);
+
+extern "C" bool effect_runner_reactive_splash(uint8_t start, effect_params_t* params, reactive_splash_f effect_func);
+extern "C" bool effect_runner_reactive_splash_reach(uint8_t start, effect_params_t* params, reactive_splash_f effect_func, reactive_splash_reach_f reach_func);
+extern "C" HSV  SOLID_SPLASH_math(HSV hsv, int16_t dx, int16_t dy, uint8_t dist, uint16_t tick);
+extern "C" bool SOLID_SPLASH_reach(uint16_t tick, uint8_t* inner, uint8_t* outer);
+extern "C" HSV  SOLID_REACTIVE_CROSS_math(HSV hsv, int16_t dx, int16_t dy, uint8_t dist, uint16_t tick);
+extern "C" bool SOLID_REACTIVE_CROSS_reach(uint16_t tick, uint8_t* inner, uint8_t* outer);
+extern "C" HSV  SOLID_REACTIVE_WIDE_math(HSV hsv, int16_t dx, int16_t dy, uint8_t dist, uint16_t tick);
+extern "C" bool SOLID_REACTIVE_WIDE_reach(uint16_t tick, uint8_t* inner, uint8_t* outer);
+extern "C" HSV  SOLID_REACTIVE_NEXUS_math(HSV hsv, int16_t dx, int16_t dy, uint8_t dist, uint16_t tick);
+extern "C" bool SOLID_REACTIVE_NEXUS_reach(uint16_t tick, uint8_t* inner, uint8_t* outer);
+
+/* A 20 by 5 grid spread over the usual 224 by 64 area. */
+static led_point_t splash_point(uint8_t index) { return {(uint8_t)(index % 20 * 224 / 19), (uint8_t)(index / 20 * 16)}; }
+
+led_config_t g_led_config = test_rgb_matrix_underglow_layout(splash_point);
+
+static uint32_t          splash_calls = 0;
+static reactive_splash_f splash_math  = &SOLID_SPLASH_math;
+
+static HSV counting_math(HSV hsv, int16_t dx, int16_t dy, uint8_t dist, uint16_t tick) {
+    splash_calls++;
+    return splash_math(hsv, dx, dy, dist, tick);
+}
+
+class RgbMatrixReactiveSplash : public RgbMatrixTestFixture {
+   protected:
+    void SetUp() override {
+        RgbMatrixTestFixture::SetUp();
+        rgb_matrix_sethsv_noeeprom(HSV_WHITE);
+        rgb_matrix_set_speed_noeeprom(UINT8_MAX);
+        splash_math = &SOLID_SPLASH_math;
+    }
+
+    /* Hits spread over the board, the oldest first, each 40 ms younger than the one before. */
+    void hit(uint16_t oldest) {
+        const led_point_t points[] = {{0, 0}, {224, 64}, {112, 32}, {60, 48}, {170, 16}};
+
+        g_last_hit_tracker.count = sizeof(points) / sizeof(points[0]);
+        for (uint8_t j = 0; j < g_last_hit_tracker.count; j++) {
+            g_last_hit_tracker.x[j]     = points[j].x;
+            g_last_hit_tracker.y[j]     = points[j].y;
+            g_last_hit_tracker.index[j] = 0;
+            g_last_hit_tracker.tick[j]  = oldest > j * 40 ? oldest - j * 40 : 0;
+        }
+    }
+
+    /* Renders hits of every age with and without the reach function, and expects the same LEDs from both. */
+    void expect_same_leds(reactive_splash_f math, reactive_splash_reach_f reach_func, bool same_hue) {
+        RGB every_pair[DRIVER_LED_TOTAL];
+
+        splash_math = math;
+        // Saturated, so a change of hue shows in the colours
+        rgb_matrix_sethsv_noeeprom(HSV_RED);
+        for (uint16_t oldest = 0; oldest < 700; oldest += 9) {
+            hit(oldest);
+            render(NULL);
+            std::memcpy(every_pair, test_rgb_matrix_leds, sizeof(every_pair));
+            render(reach_func);
+
+            for (uint8_t i = 0; i < DRIVER_LED_TOTAL; i++) {
+                RGB reached = test_rgb_matrix_leds[i];
+                if (same_hue) {
+                    EXPECT_EQ(reached.r, every_pair[i].r) << "LED " << (int)i << " after " << oldest << " ms";
+                    EXPECT_EQ(reached.g, every_pair[i].g) << "LED " << (int)i << " after " << oldest << " ms";
+                    EXPECT_EQ(reached.b, every_pair[i].b) << "LED " << (int)i << " after " << oldest << " ms";
+                } else {
+                    // The brightest channel is the value the LED was given
+                    EXPECT_EQ(std::max({reached.r, reached.g, reached.b}), std::max({every_pair[i].r, every_pair[i].g, every_pair[i].b})) << "LED " << (int)i << " after " << oldest << " ms";
+                }
+            }
+        }
+    }
+
+    void render(reactive_splash_reach_f reach_func) {
+        effect_params_t params = {0, LED_FLAG_ALL, false};
+
+        splash_calls = 0;
+        while (reach_func ? effect_runner_reactive_splash_reach(0, &params, &counting_math, reach_func) : effect_runner_reactive_splash(0, &params, &counting_math)) {
+            params.iter++;
+        }
+    }
+};
+
+TEST_F(RgbMatrixReactiveSplash, ReachLightsTheSameLeds) {
+    expect_same_leds(&SOLID_SPLASH_math, &SOLID_SPLASH_reach, true);
+}
+
+TEST_F(RgbMatrixReactiveSplash, CrossReachLightsTheSameLeds) {
+    expect_same_leds(&SOLID_REACTIVE_CROSS_math, &SOLID_REACTIVE_CROSS_reach, true);
+}
+
+TEST_F(RgbMatrixReactiveSplash, WideReachLightsTheSameLeds) {
+    expect_same_leds(&SOLID_REACTIVE_WIDE_math, &SOLID_REACTIVE_WIDE_reach, true);
+}
+
+TEST_F(RgbMatrixReactiveSplash, NexusReachLightsTheSameLeds) {
+    // Hits out of reach no longer tint the LEDs, so only the brightness is the same
+    expect_same_leds(&SOLID_REACTIVE_NEXUS_math, &SOLID_REACTIVE_NEXUS_reach, false);
+}
+
+TEST_F(RgbMatrixReactiveSplash, ReachSkipsPairsOutOfRange) {
+    hit(100);
+    render(NULL);
+    EXPECT_EQ(splash_calls, DRIVER_LED_TOTAL * g_last_hit_tracker.count);
+    render(&SOLID_SPLASH_reach);
+    EXPECT_GT(splash_calls, 0);
+    EXPECT_LT(splash_calls, DRIVER_LED_TOTAL * g_last_hit_tracker.count / 2);
+}
+
+TEST_F(RgbMatrixReactiveSplash, ExpiredHitsAreSkipped) {
+    hit(2000);
+    render(&SOLID_SPLASH_reach);
+    EXPECT_EQ(splash_calls, 0);
+    for (uint8_t i = 0; i < DRIVER_LED_TOTAL; i++) {
+        EXPECT_EQ(test_rgb_matrix_leds[i].r | test_rgb_matrix_leds[i].g | test_rgb_matrix_leds[i].b, 0) << "LED " << (int)i;
+    }
+}
@@ -0,0 +1,124 @@
+/* Copyright 2022 QMK
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <utility>
+#include <vector>
+#include "gtest/gtest.h"
+#include "test_rgb_matrix.hpp"
+
+extern "C" void advance_time(uint32_t ms);
+extern "C" void advance_time_us(uint32_t us);
+
+/* A single row of underglow LEDs. */
+static led_point_t budget_point(uint8_t index) { return {(uint8_t)(index * 224 / (DRIVER_LED_TOTAL - 1)), 32}; }
+
+led_config_t g_led_config = test_rgb_matrix_underglow_layout(budget_point);
+
+/* Every colour conversion takes this long, which makes the cost of each LED of the effect under test known. */
+static uint32_t conversion_us = 0;
+
+extern "C" RGB rgb_matrix_hsv_to_rgb(HSV hsv) {
+    advance_time_us(conversion_us);
+    return {hsv.v, hsv.v, hsv.v};
+}
+
+/* The LEDs of every render iteration, as handed to the indicators. */
+static std::vector<std::pair<uint8_t, uint8_t>> slices;
+
+extern "C" void rgb_matrix_indicators_advanced_user(uint8_t led_min, uint8_t led_max) { slices.push_back({led_min, led_max}); }
+
+class RgbMatrixRenderBudget : public RgbMatrixTestFixture {
+   protected:
+    void SetUp() override {
+        RgbMatrixTestFixture::SetUp();
+        rgb_matrix_mode_noeeprom(RGB_MATRIX_CYCLE_LEFT_RIGHT);
+    }
+
+    void run(uint32_t ms) {
+        for (uint32_t i = 0; i < ms; i++) {
+            rgb_matrix_task();
+            advance_time(1);
+        }
+    }
+
+    /* Checks that the slices of each whole frame follow on from each other and end with the last LED, and returns the widest. */
+    uint8_t check_frames() {
+        uint8_t widest  = 0;
+        uint8_t next    = 0;
+        bool    started = false;
+
+        for (auto &slice : slices) {
+            // The slices were cleared part way through a frame, so skip to the next one
+            if (!started && slice.first != 0) continue;
+            started = true;
+            if (slice.first == 0) {
+                EXPECT_EQ(next, 0) << "frame ended early at LED " << (int)next;
+                next = 0;
+            }
+            EXPECT_EQ(slice.first, next);
+            EXPECT_GT(slice.second, slice.first);
+            widest = std::max(widest, (uint8_t)(slice.second - slice.first));
+            next   = slice.second == DRIVER_LED_TOTAL ? 0 : slice.second;
+        }
+        return widest;
+    }
+};
+
+TEST_F(RgbMatrixRenderBudget, CheapEffectRendersWholeFrames) {
+    conversion_us = 0;
+    run(200);
+    slices.clear();
+    run(200);
+
+    ASSERT_FALSE(slices.empty());
+    EXPECT_EQ(check_frames(), RGB_MATRIX_RENDER_SLICE_MAX);
+    for (auto &slice : slices) {
+        EXPECT_TRUE(slice.first == 0 || slice.first == RGB_MATRIX_RENDER_SLICE_MAX);
+    }
+}
+
+TEST_F(RgbMatrixRenderBudget, SlowEffectIsSplitToFitBudget) {
+    // A quarter of a millisecond per LED fits sixteen LEDs into the four millisecond budget
+    conversion_us = 250;
+    run(2000);
+    slices.clear();
+    run(2000);
+
+    ASSERT_FALSE(slices.empty());
+    EXPECT_EQ(check_frames(), RGB_MATRIX_RENDER_BUDGET_US / 250);
+
+    rgb_matrix_render_stats_t stats = rgb_matrix_get_render_stats();
+    EXPECT_EQ(stats.slice_leds, RGB_MATRIX_RENDER_BUDGET_US / 250);
+    EXPECT_EQ(stats.worst_slice_us, RGB_MATRIX_RENDER_BUDGET_US);
+    // Each frame takes at least the ten milliseconds its LEDs cost
+    EXPECT_GT(stats.fps, 0);
+    EXPECT_LE(stats.fps, 1000000 / (DRIVER_LED_TOTAL * 250));
+}
+
+TEST_F(RgbMatrixRenderBudget, SliceGrowsBackOnceEffectIsCheap) {
+    conversion_us = 250;
+    run(2000);
+    ASSERT_EQ(rgb_matrix_get_render_stats().slice_leds, RGB_MATRIX_RENDER_BUDGET_US / 250);
+
+    conversion_us = 0;
+    run(2000);
+    slices.clear();
+    run(200);
+
+    ASSERT_FALSE(slices.empty());
+    EXPECT_EQ(check_frames(), RGB_MATRIX_RENDER_SLICE_MAX);
+    EXPECT_EQ(rgb_matrix_get_render_stats().slice_leds, RGB_MATRIX_RENDER_SLICE_MAX);
+}
@@ -0,0 +1,136 @@
+/* Copyright 2022 QMK
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "gtest/gtest.h"
+#include "keyboard_report_util.hpp"
+#include "test_common.hpp"
+
+using testing::_;
+using testing::InSequence;
+
+static int         callback_count;
+static const char *callback_str;
+
+static void on_sent(const char *str) {
+    callback_count++;
+    callback_str = str;
+}
+
+class SendStringQueue : public TestFixture {
+   protected:
+    void SetUp() override {
+        callback_count = 0;
+        callback_str   = nullptr;
+    }
+};
+
+TEST_F(SendStringQueue, OneReportPerScan) {
+    TestDriver driver;
+    InSequence s;
+    static const char str[] = "aB";
+
+    EXPECT_TRUE(send_string_queued(str, on_sent));
+    EXPECT_EQ(send_string_queue_depth(), 1);
+
+    EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_A)));
+    run_one_scan_loop();
+    testing::Mock::VerifyAndClearExpectations(&driver);
+
+    EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport()));
+    run_one_scan_loop();
+    testing::Mock::VerifyAndClearExpectations(&driver);
+
+    EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_LEFT_SHIFT)));
+    run_one_scan_loop();
+    testing::Mock::VerifyAndClearExpectations(&driver);
+
+    EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_LEFT_SHIFT, KC_B)));
+    run_one_scan_loop();
+    testing::Mock::VerifyAndClearExpectations(&driver);
+
+    EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_LEFT_SHIFT)));
+    run_one_scan_loop();
+    testing::Mock::VerifyAndClearExpectations(&driver);
+
+    EXPECT_EQ(callback_count, 0);
+    EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport()));
+    run_one_scan_loop();
+    testing::Mock::VerifyAndClearExpectations(&driver);
+
+    /* The callback runs on the scan after the last report, once the end of the string is read. */
+    EXPECT_CALL(driver, send_keyboard_mock(_)).Times(0);
+    idle_for(5);
+    testing::Mock::VerifyAndClearExpectations(&driver);
+    EXPECT_EQ(callback_count, 1);
+    EXPECT_EQ(callback_str, str);
+    EXPECT_EQ(send_string_queue_depth(), 0);
+}
+
+TEST_F(SendStringQueue, RejectsWhenFull) {
+    TestDriver driver;
+    InSequence s;
+
+    EXPECT_TRUE(send_string_queued("a", on_sent));
+    EXPECT_TRUE(send_string_queued_P(PSTR("b"), on_sent));
+    EXPECT_FALSE(send_string_queued("c", on_sent));
+    EXPECT_EQ(send_string_queue_depth(), 2);
+
+    /* Strings are sent in the order they were queued. */
+    EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_A)));
+    EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport()));
+    EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_B)));
+    EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport()));
+    idle_for(10);
+    testing::Mock::VerifyAndClearExpectations(&driver);
+    EXPECT_EQ(callback_count, 2);
+    EXPECT_EQ(send_string_queue_depth(), 0);
+}
+
+TEST_F(SendStringQueue, DelayDoesNotBlockKeyProcessing) {
+    TestDriver driver;
+    InSequence s;
+    auto       key_c = KeymapKey(0, 0, 0, KC_C);
+
+    set_keymap({key_c});
+
+    SEND_STRING_QUEUED("a" SS_DELAY(50) "b", on_sent);
+
+    EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_A)));
+    EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport()));
+    idle_for(2);
+    testing::Mock::VerifyAndClearExpectations(&driver);
+
+    /* A physical key pressed during the delay goes out straight away. */
+    EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_C)));
+    key_c.press();
+    run_one_scan_loop();
+    testing::Mock::VerifyAndClearExpectations(&driver);
+
+    EXPECT_CALL(driver, send_keyboard_mock(_)).Times(0);
+    idle_for(45);
+    testing::Mock::VerifyAndClearExpectations(&driver);
+
+    EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_C, KC_B)));
+    EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_C)));
+    idle_for(10);
+    testing::Mock::VerifyAndClearExpectations(&driver);
+    EXPECT_EQ(callback_count, 1);
+
+    EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport()));
+    key_c.release();
+    run_one_scan_loop();
+    testing::Mock::VerifyAndClearExpectations(&driver);
+}
@@ -0,0 +1,33 @@
+/* Copyright 2022 QMK
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "test_pointing_device.hpp"
+
+test_sensor_t test_sensor = {};
+
+extern "C" report_mouse_t pointing_device_driver_get_report(report_mouse_t mouse_report) {
+    mouse_report.x       = constrain_hid_xy(test_sensor.x);
+    mouse_report.y       = constrain_hid_xy(test_sensor.y);
+    mouse_report.v       = test_sensor.v;
+    mouse_report.h       = test_sensor.h;
+    mouse_report.buttons = test_sensor.buttons;
+    test_sensor.x        = 0;
+    test_sensor.y        = 0;
+    test_sensor.v        = 0;
+    test_sensor.h        = 0;
+    test_sensor.reads++;
+    return mouse_report;
+}
@@ -0,0 +1,32 @@
+/* Copyright 2022 QMK
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "test_common.hpp"
+
+/* Movement and buttons the fake sensor reports on its next read. The movement is cleared once read, so
+ * adding to it between reads works like a sensor counting in hardware. */
+struct test_sensor_t {
+    int32_t  x;
+    int32_t  y;
+    int8_t   v;
+    int8_t   h;
+    uint8_t  buttons;
+    uint32_t reads;
+};
+
+extern test_sensor_t test_sensor;
@@ -0,0 +1,60 @@
+/* Copyright 2022 QMK
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <cstring>
+#include "test_rgb_matrix.hpp"
+
+RGB      test_rgb_matrix_leds[DRIVER_LED_TOTAL];
+uint32_t test_rgb_matrix_flushes = 0;
+
+led_config_t test_rgb_matrix_underglow_layout(led_point_t (*point)(uint8_t index)) {
+    led_config_t layout = {};
+
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            layout.matrix_co[row][col] = NO_LED;
+        }
+    }
+    for (uint8_t i = 0; i < DRIVER_LED_TOTAL; i++) {
+        layout.point[i] = point(i);
+        layout.flags[i] = LED_FLAG_UNDERGLOW;
+    }
+    return layout;
+}
+
+static void test_rgb_matrix_init(void) {}
+
+static void test_rgb_matrix_set_color(int index, uint8_t red, uint8_t green, uint8_t blue) {
+    test_rgb_matrix_leds[index].r = red;
+    test_rgb_matrix_leds[index].g = green;
+    test_rgb_matrix_leds[index].b = blue;
+}
+
+static void test_rgb_matrix_set_color_all(uint8_t red, uint8_t green, uint8_t blue) {
+    for (int i = 0; i < DRIVER_LED_TOTAL; i++) {
+        test_rgb_matrix_set_color(i, red, green, blue);
+    }
+}
+
+static void test_rgb_matrix_flush(void) { test_rgb_matrix_flushes++; }
+
+extern "C" const rgb_matrix_driver_t rgb_matrix_driver = {test_rgb_matrix_init, test_rgb_matrix_set_color, test_rgb_matrix_set_color_all, test_rgb_matrix_flush};
+
+void RgbMatrixTestFixture::SetUp() {
+    std::memset(test_rgb_matrix_leds, 0, sizeof(test_rgb_matrix_leds));
+    test_rgb_matrix_flushes = 0;
+    rgb_matrix_enable_noeeprom();
+}
@@ -0,0 +1,32 @@
+/* Copyright 2022 QMK
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "test_common.hpp"
+
+/* Colours the recording rgb_matrix_driver was last given for each LED, and the frames it has flushed. */
+extern RGB      test_rgb_matrix_leds[DRIVER_LED_TOTAL];
+extern uint32_t test_rgb_matrix_flushes;
+
+/* A layout with no LEDs under keys, where every LED is underglow at the point given for it. */
+led_config_t test_rgb_matrix_underglow_layout(led_point_t (*point)(uint8_t index));
+
+/* Base for tests rendering through the recording driver, which starts each test enabled and dark. */
+class RgbMatrixTestFixture : public TestFixture {
+   protected:
+    void SetUp() override;
+};
@@ -97,6 +97,10 @@ void send_keyboard(report_keyboard_t *report) {
 #endif  // NKRO_ENABLE
 }
 
+#if defined(MOUSE_EXTENDED_REPORT) || defined(POINTING_DEVICE_HIRES_SCROLL_ENABLE)
+#    error Extended mouse reports are not supported on ARM ATSAM. Please disable MOUSE_EXTENDED_REPORT and POINTING_DEVICE_HIRES_SCROLL_ENABLE.
+#endif
+
 void send_mouse(report_mouse_t *report) {
 #ifdef MOUSEKEY_ENABLE
     uint32_t irqflags;
@@ -561,6 +561,11 @@ static void    set_led_transfer_cb(USBDriver *usbp) {
         if ((report_id == REPORT_ID_KEYBOARD) || (report_id == REPORT_ID_NKRO)) {
             keyboard_led_state = set_report_buf[1];
         }
+#if defined(MOUSE_SHARED_EP) && defined(POINTING_DEVICE_HIRES_SCROLL_ENABLE)
+        if (report_id == REPORT_ID_MOUSE) {
+            mouse_resolution_multiplier = set_report_buf[1];
+        }
+#endif
     } else {
         keyboard_led_state = set_report_buf[0];
     }
@@ -608,6 +613,12 @@ static bool usb_request_hook_cb(USBDriver *usbp) {
                             usbSetupTransfer(usbp, &keyboard_protocol, 1, NULL);
                             return TRUE;
                         }
+#if defined(MOUSE_ENABLE) && !defined(MOUSE_SHARED_EP)
+                        if ((usbp->setup[4] == MOUSE_INTERFACE) && (usbp->setup[5] == 0)) { /* wIndex */
+                            usbSetupTransfer(usbp, &mouse_protocol, 1, NULL);
+                            return TRUE;
+                        }
+#endif
                         break;
 
                     case HID_GET_IDLE:
@@ -628,10 +639,22 @@ static bool usb_request_hook_cb(USBDriver *usbp) {
                                 usbSetupTransfer(usbp, set_report_buf, sizeof(set_report_buf), set_led_transfer_cb);
                                 return TRUE;
                                 break;
+#if defined(MOUSE_ENABLE) && !defined(MOUSE_SHARED_EP) && defined(POINTING_DEVICE_HIRES_SCROLL_ENABLE)
+                            case MOUSE_INTERFACE:
+                                /* Resolution Multiplier feature report */
+                                usbSetupTransfer(usbp, &mouse_resolution_multiplier, 1, NULL);
+                                return TRUE;
+                                break;
+#endif
                         }
                         break;
 
                     case HID_SET_PROTOCOL:
+#if defined(MOUSE_ENABLE) && !defined(MOUSE_SHARED_EP)
+                        if ((usbp->setup[4] == MOUSE_INTERFACE) && (usbp->setup[5] == 0)) { /* wIndex */
+                            mouse_protocol = ((usbp->setup[2]) != 0x00);                    /* LSB(wValue) */
+                        }
+#endif
                         if ((usbp->setup[4] == KEYBOARD_INTERFACE) && (usbp->setup[5] == 0)) { /* wIndex */
                             keyboard_protocol = ((usbp->setup[2]) != 0x00);                    /* LSB(wValue) */
 #ifdef NKRO_ENABLE
@@ -775,7 +798,19 @@ void kbd_in_cb(USBDriver *usbp, usbep_t ep) {
 /* start-of-frame handler
  * TODO: i guess it would be better to re-implement using timers,
  *  so that this is not going to have to be checked every 1ms */
+#ifdef HOST_REPORT_QUEUE_SIZE
+static volatile uint16_t usb_frame = 0;
+
+void kbd_sof_cb(USBDriver *usbp) {
+    (void)usbp;
+    usb_frame++;
+}
+
+/* host frames seen so far, so that queued reports go out at most once per frame */
+uint16_t host_report_frame(void) { return usb_frame; }
+#else
 void kbd_sof_cb(USBDriver *usbp) { (void)usbp; }
+#endif
 
 /* Idle requests timer code
  * callback (called from ISR, unlocked state) */
@@ -817,6 +852,20 @@ static void keyboard_idle_timer_cb(void *arg) {
 /* LED status */
 uint8_t keyboard_leds(void) { return keyboard_led_state; }
 
+/* whether send_keyboard() would start transmitting straight away */
+bool host_keyboard_ready(void) {
+    uint8_t ep = KEYBOARD_IN_EPNUM;
+#ifdef NKRO_ENABLE
+    if (keymap_config.nkro && keyboard_protocol) {
+        ep = SHARED_IN_EPNUM;
+    }
+#endif
+    osalSysLock();
+    bool ready = usbGetDriverStateI(&USB_DRIVER) == USB_ACTIVE && !usbGetTransmitStatusI(&USB_DRIVER, ep);
+    osalSysUnlock();
+    return ready;
+}
+
 /* prepare and start sending a report IN
  * not callable from ISR or locked state */
 void send_keyboard(report_keyboard_t *report) {
@@ -914,6 +963,13 @@ void send_mouse(report_mouse_t *report) {
     osalSysUnlock();
 }
 
+bool host_mouse_ready(void) {
+    osalSysLock();
+    bool ready = usbGetDriverStateI(&USB_DRIVER) == USB_ACTIVE && !usbGetTransmitStatusI(&USB_DRIVER, MOUSE_IN_EPNUM);
+    osalSysUnlock();
+    return ready;
+}
+
 #else  /* MOUSE_ENABLE */
 void send_mouse(report_mouse_t *report) { (void)report; }
 #endif /* MOUSE_ENABLE */
@@ -961,6 +1017,13 @@ static void send_extra(uint8_t report_id, uint16_t data) {
     usbStartTransmitI(&USB_DRIVER, SHARED_IN_EPNUM, (uint8_t *)&report, sizeof(report_extra_t));
     osalSysUnlock();
 }
+
+bool host_extra_ready(void) {
+    osalSysLock();
+    bool ready = usbGetDriverStateI(&USB_DRIVER) == USB_ACTIVE && !usbGetTransmitStatusI(&USB_DRIVER, SHARED_IN_EPNUM);
+    osalSysUnlock();
+    return ready;
+}
 #endif
 
 void send_system(uint16_t data) {
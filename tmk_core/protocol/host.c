@@ -23,12 +23,23 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include "util.h"
 #include "debug.h"
 #include "digitizer.h"
+#ifdef HOST_REPORT_QUEUE_SIZE
+#    include <string.h>
+#    include "timer.h"
+#endif
 
-#ifdef NKRO_ENABLE
+#if defined(NKRO_ENABLE) || defined(HOST_REPORT_QUEUE_SIZE)
 #    include "keycode_config.h"
 extern keymap_config_t keymap_config;
 #endif
 
+#ifdef MOUSE_ENABLE
+uint8_t mouse_protocol = 1;
+#    ifdef POINTING_DEVICE_HIRES_SCROLL_ENABLE
+uint8_t mouse_resolution_multiplier = 0;
+#    endif
+#endif
+
 static host_driver_t *driver;
 static uint16_t       last_system_report              = 0;
 static uint16_t       last_consumer_report            = 0;
@@ -53,6 +64,224 @@ uint8_t host_keyboard_leds(void) {
 
 led_t host_keyboard_led_state(void) { return (led_t)host_keyboard_leds(); }
 
+/* whether the driver can take another report on that endpoint without waiting */
+__attribute__((weak)) bool host_keyboard_ready(void) { return true; }
+__attribute__((weak)) bool host_mouse_ready(void) { return true; }
+__attribute__((weak)) bool host_extra_ready(void) { return true; }
+
+#ifdef HOST_REPORT_QUEUE_SIZE
+#    if HOST_REPORT_QUEUE_SIZE > 255
+#        error "HOST_REPORT_QUEUE_SIZE must be less than 256"
+#    endif
+
+/* Reports that the driver could not take straight away wait here, one queue per endpoint.
+ * A report that only adds to the state of the queued one replaces it, and at most one
+ * report per endpoint goes out per host frame, so a burst of changes within a polling
+ * interval reaches the host as a single report without the main loop ever waiting.
+ */
+typedef struct {
+    uint8_t  head;
+    uint8_t  count;
+    bool     sent;   // whether a report went out during `frame`
+    uint16_t frame;
+} host_report_queue_t;
+
+typedef struct {
+    uint8_t  report_id;
+    uint16_t usage;
+} host_extra_entry_t;
+
+static report_keyboard_t   keyboard_queue[HOST_REPORT_QUEUE_SIZE];
+static report_keyboard_t   keyboard_inflight;
+static host_report_queue_t keyboard_queue_state;
+#    ifdef MOUSE_ENABLE
+static report_mouse_t      mouse_queue[HOST_REPORT_QUEUE_SIZE];
+static report_mouse_t      mouse_inflight;
+static host_report_queue_t mouse_queue_state;
+#    endif
+static host_extra_entry_t  extra_queue[HOST_REPORT_QUEUE_SIZE];
+static host_report_queue_t extra_queue_state;
+
+static host_report_stats_t report_stats;
+
+/* Host frame counter, one tick per USB start-of-frame. Drivers that see SOF override it. */
+__attribute__((weak)) uint16_t host_report_frame(void) { return timer_read(); }
+
+host_report_stats_t host_report_get_stats(void) { return report_stats; }
+
+static bool queue_can_send(host_report_queue_t *queue, bool endpoint_ready) {
+    if (!queue->count || !endpoint_ready) return false;
+    return !(queue->sent && queue->frame == host_report_frame());
+}
+
+static void queue_mark_sent(host_report_queue_t *queue) {
+    queue->head  = (queue->head + 1) % HOST_REPORT_QUEUE_SIZE;
+    queue->count--;
+    queue->sent  = true;
+    queue->frame = host_report_frame();
+    report_stats.sent++;
+}
+
+static uint8_t queue_index(host_report_queue_t *queue, uint8_t offset) { return (queue->head + offset) % HOST_REPORT_QUEUE_SIZE; }
+
+/* Returns the slot for a new report: a free one, or the newest queued report when full */
+static uint8_t queue_push(host_report_queue_t *queue) {
+    if (queue->count == HOST_REPORT_QUEUE_SIZE) {
+        report_stats.dropped++;
+        return queue_index(queue, queue->count - 1);
+    }
+    return queue_index(queue, queue->count++);
+}
+
+/* Whether replacing `tail` with `next` hides no transition from the host, i.e. no key
+ * changes state both between `prev` and `tail` and between `tail` and `next`.
+ */
+static bool keyboard_report_can_merge(report_keyboard_t *prev, report_keyboard_t *tail, report_keyboard_t *next) {
+#    ifdef NKRO_ENABLE
+    if (keyboard_protocol && keymap_config.nkro) {
+        if ((prev->nkro.mods ^ tail->nkro.mods) & (tail->nkro.mods ^ next->nkro.mods)) return false;
+        for (uint8_t i = 0; i < KEYBOARD_REPORT_BITS; i++) {
+            if ((prev->nkro.bits[i] ^ tail->nkro.bits[i]) & (tail->nkro.bits[i] ^ next->nkro.bits[i])) return false;
+        }
+        return true;
+    }
+#    endif
+    if ((prev->mods ^ tail->mods) & (tail->mods ^ next->mods)) return false;
+    for (uint8_t i = 0; i < KEYBOARD_REPORT_KEYS; i++) {
+        // pressed, then released
+        if (tail->keys[i] && !is_key_pressed(prev, tail->keys[i]) && !is_key_pressed(next, tail->keys[i])) return false;
+        // released, then pressed again
+        if (prev->keys[i] && !is_key_pressed(tail, prev->keys[i]) && is_key_pressed(next, prev->keys[i])) return false;
+    }
+    return true;
+}
+
+static void keyboard_transmit(report_keyboard_t *report) {
+    (*driver->send_keyboard)(report);
+
+    if (debug_keyboard) {
+        dprint("keyboard_report: ");
+        for (uint8_t i = 0; i < KEYBOARD_REPORT_SIZE; i++) {
+            dprintf("%02X ", report->raw[i]);
+        }
+        dprint("\n");
+    }
+}
+
+static void keyboard_queue_flush(void) {
+    if (!queue_can_send(&keyboard_queue_state, host_keyboard_ready())) return;
+
+    // The driver may still be reading the report while it goes out, so it gets a copy that stays put
+    keyboard_inflight = keyboard_queue[keyboard_queue_state.head];
+    queue_mark_sent(&keyboard_queue_state);
+    keyboard_transmit(&keyboard_inflight);
+}
+
+static void keyboard_queue_send(report_keyboard_t *report) {
+    host_report_queue_t *queue = &keyboard_queue_state;
+
+    keyboard_queue_flush();
+    if (queue->count) {
+        report_keyboard_t *tail = &keyboard_queue[queue_index(queue, queue->count - 1)];
+        report_keyboard_t *prev = queue->count > 1 ? &keyboard_queue[queue_index(queue, queue->count - 2)] : &keyboard_inflight;
+        if (keyboard_report_can_merge(prev, tail, report)) {
+            *tail = *report;
+            report_stats.merged++;
+            return;
+        }
+    }
+    keyboard_queue[queue_push(queue)] = *report;
+    keyboard_queue_flush();
+}
+
+#    ifdef MOUSE_ENABLE
+static bool mouse_report_can_merge(report_mouse_t *tail, report_mouse_t *next) {
+    if (tail->buttons != next->buttons) return false;
+    // Movement is relative, so it can be summed as long as the total still fits
+    int32_t x = (int32_t)tail->x + next->x, y = (int32_t)tail->y + next->y, v = (int32_t)tail->v + next->v, h = (int32_t)tail->h + next->h;
+#        ifdef MOUSE_EXTENDED_REPORT
+    // Boot protocol hosts only see the 8-bit copy
+    if (!mouse_protocol && (x < -127 || x > 127 || y < -127 || y > 127)) return false;
+#        endif
+    return x >= -MOUSE_REPORT_XY_MAX && x <= MOUSE_REPORT_XY_MAX && y >= -MOUSE_REPORT_XY_MAX && y <= MOUSE_REPORT_XY_MAX && v >= -MOUSE_REPORT_HV_MAX && v <= MOUSE_REPORT_HV_MAX && h >= -MOUSE_REPORT_HV_MAX && h <= MOUSE_REPORT_HV_MAX;
+}
+
+static void mouse_queue_flush(void) {
+    if (!queue_can_send(&mouse_queue_state, host_mouse_ready())) return;
+
+    mouse_inflight = mouse_queue[mouse_queue_state.head];
+    queue_mark_sent(&mouse_queue_state);
+    (*driver->send_mouse)(&mouse_inflight);
+}
+
+static void mouse_queue_send(report_mouse_t *report) {
+    host_report_queue_t *queue = &mouse_queue_state;
+
+    mouse_queue_flush();
+    if (queue->count) {
+        report_mouse_t *tail = &mouse_queue[queue_index(queue, queue->count - 1)];
+        if (mouse_report_can_merge(tail, report)) {
+            tail->x += report->x;
+            tail->y += report->y;
+            tail->v += report->v;
+            tail->h += report->h;
+#        ifdef MOUSE_EXTENDED_REPORT
+            tail->boot_x = tail->x;
+            tail->boot_y = tail->y;
+#        endif
+            report_stats.merged++;
+            return;
+        }
+    }
+    mouse_queue[queue_push(queue)] = *report;
+    mouse_queue_flush();
+}
+#    endif
+
+static void extra_queue_flush(void) {
+    if (!queue_can_send(&extra_queue_state, host_extra_ready())) return;
+
+    host_extra_entry_t entry = extra_queue[extra_queue_state.head];
+    queue_mark_sent(&extra_queue_state);
+    if (entry.report_id == REPORT_ID_SYSTEM) {
+        (*driver->send_system)(entry.usage);
+    } else {
+        (*driver->send_consumer)(entry.usage);
+    }
+}
+
+/* System and consumer reports hold a single usage, so every change is a transition the host must see */
+static void extra_queue_send(uint8_t report_id, uint16_t usage) {
+    extra_queue_flush();
+    extra_queue[queue_push(&extra_queue_state)] = (host_extra_entry_t){.report_id = report_id, .usage = usage};
+    extra_queue_flush();
+}
+
+/** \brief Sends the reports that are waiting for the host
+ *
+ * Called from keyboard_task(). With debug enabled, the counters are printed once a second while they change.
+ */
+void host_report_task(void) {
+    static uint32_t            last_print = 0;
+    static host_report_stats_t last_stats = {0};
+
+    if (!driver) return;
+    keyboard_queue_flush();
+#    ifdef MOUSE_ENABLE
+    mouse_queue_flush();
+#    endif
+    extra_queue_flush();
+
+    if (debug_enable && timer_elapsed32(last_print) >= 1000) {
+        last_print = timer_read32();
+        if (memcmp(&last_stats, &report_stats, sizeof(report_stats))) {
+            last_stats = report_stats;
+            dprintf("host reports: sent %lu merged %lu dropped %lu\n", (unsigned long)report_stats.sent, (unsigned long)report_stats.merged, (unsigned long)report_stats.dropped);
+        }
+    }
+}
+#endif
+
 /* send report */
 void host_keyboard_send(report_keyboard_t *report) {
     if (!driver) return;
@@ -70,6 +299,9 @@ void host_keyboard_send(report_keyboard_t *report) {
         report->report_id = REPORT_ID_KEYBOARD;
 #endif
     }
+#ifdef HOST_REPORT_QUEUE_SIZE
+    keyboard_queue_send(report);
+#else
     (*driver->send_keyboard)(report);
 
     if (debug_keyboard) {
@@ -79,6 +311,7 @@ void host_keyboard_send(report_keyboard_t *report) {
         }
         dprint("\n");
     }
+#endif
 }
 
 void host_mouse_send(report_mouse_t *report) {
@@ -86,15 +319,37 @@ void host_mouse_send(report_mouse_t *report) {
 #ifdef MOUSE_SHARED_EP
     report->report_id = REPORT_ID_MOUSE;
 #endif
+#ifdef MOUSE_EXTENDED_REPORT
+    // Clip to the boot protocol range; pointing_device_send() splits larger movements for boot protocol hosts
+    report->boot_x = (report->x > 127) ? 127 : ((report->x < -127) ? -127 : report->x);
+    report->boot_y = (report->y > 127) ? 127 : ((report->y < -127) ? -127 : report->y);
+#endif
+#if defined(HOST_REPORT_QUEUE_SIZE) && defined(MOUSE_ENABLE)
+    mouse_queue_send(report);
+#else
     (*driver->send_mouse)(report);
+#endif
 }
 
+#ifdef MOUSE_ENABLE
+uint16_t host_mouse_scroll_resolution(void) {
+#    ifdef POINTING_DEVICE_HIRES_SCROLL_ENABLE
+    if (mouse_resolution_multiplier & 0x03) return POINTING_DEVICE_HIRES_SCROLL_MULTIPLIER;
+#    endif
+    return 1;
+}
+#endif
+
 void host_system_send(uint16_t report) {
     if (report == last_system_report) return;
     last_system_report = report;
 
     if (!driver) return;
+#ifdef HOST_REPORT_QUEUE_SIZE
+    extra_queue_send(REPORT_ID_SYSTEM, report);
+#else
     (*driver->send_system)(report);
+#endif
 }
 
 void host_consumer_send(uint16_t report) {
@@ -102,7 +357,11 @@ void host_consumer_send(uint16_t report) {
     last_consumer_report = report;
 
     if (!driver) return;
+#ifdef HOST_REPORT_QUEUE_SIZE
+    extra_queue_send(REPORT_ID_CONSUMER, report);
+#else
     (*driver->send_consumer)(report);
+#endif
 }
 
 void host_digitizer_send(digitizer_t *digitizer) {
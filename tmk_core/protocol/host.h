@@ -35,6 +35,12 @@ extern "C" {
 
 extern uint8_t keyboard_idle;
 extern uint8_t keyboard_protocol;
+#ifdef MOUSE_ENABLE
+extern uint8_t mouse_protocol;
+#    ifdef POINTING_DEVICE_HIRES_SCROLL_ENABLE
+extern uint8_t mouse_resolution_multiplier;
+#    endif
+#endif
 
 /* host driver */
 void           host_set_driver(host_driver_t *driver);
@@ -45,14 +51,32 @@ uint8_t host_keyboard_leds(void);
 led_t   host_keyboard_led_state(void);
 void    host_keyboard_send(report_keyboard_t *report);
 void    host_mouse_send(report_mouse_t *report);
+#ifdef MOUSE_ENABLE
+uint16_t host_mouse_scroll_resolution(void);
+#endif
 void    host_system_send(uint16_t data);
 void    host_consumer_send(uint16_t data);
 void    host_programmable_button_send(uint32_t data);
+bool    host_keyboard_ready(void);
+bool    host_mouse_ready(void);
+bool    host_extra_ready(void);
 
 uint16_t host_last_system_report(void);
 uint16_t host_last_consumer_report(void);
 uint32_t host_last_programmable_button_report(void);
 
+#ifdef HOST_REPORT_QUEUE_SIZE
+typedef struct {
+    uint32_t sent;     // reports handed to the driver
+    uint32_t merged;   // reports folded into one that was still waiting
+    uint32_t dropped;  // reports that overwrote a waiting one because the queue was full
+} host_report_stats_t;
+
+uint16_t            host_report_frame(void);
+host_report_stats_t host_report_get_stats(void);
+void                host_report_task(void);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -603,6 +603,11 @@ void EVENT_USB_Device_ControlRequest(void) {
                             if (report_id == REPORT_ID_KEYBOARD || report_id == REPORT_ID_NKRO) {
                                 keyboard_led_state = Endpoint_Read_8();
                             }
+#if defined(MOUSE_SHARED_EP) && defined(POINTING_DEVICE_HIRES_SCROLL_ENABLE)
+                            if (report_id == REPORT_ID_MOUSE) {
+                                mouse_resolution_multiplier = Endpoint_Read_8();
+                            }
+#endif
                         } else {
                             keyboard_led_state = Endpoint_Read_8();
                         }
@@ -610,6 +615,21 @@ void EVENT_USB_Device_ControlRequest(void) {
                         Endpoint_ClearOUT();
                         Endpoint_ClearStatusStage();
                         break;
+#if defined(MOUSE_ENABLE) && !defined(MOUSE_SHARED_EP) && defined(POINTING_DEVICE_HIRES_SCROLL_ENABLE)
+                    case MOUSE_INTERFACE:
+                        // Resolution Multiplier feature report
+                        Endpoint_ClearSETUP();
+
+                        while (!(Endpoint_IsOUTReceived())) {
+                            if (USB_DeviceState == DEVICE_STATE_Unattached) return;
+                        }
+
+                        mouse_resolution_multiplier = Endpoint_Read_8();
+
+                        Endpoint_ClearOUT();
+                        Endpoint_ClearStatusStage();
+                        break;
+#endif
                 }
             }
 
@@ -625,6 +645,16 @@ void EVENT_USB_Device_ControlRequest(void) {
                     Endpoint_ClearIN();
                     Endpoint_ClearStatusStage();
                 }
+#if defined(MOUSE_ENABLE) && !defined(MOUSE_SHARED_EP)
+                if (USB_ControlRequest.wIndex == MOUSE_INTERFACE) {
+                    Endpoint_ClearSETUP();
+                    while (!(Endpoint_IsINReady()))
+                        ;
+                    Endpoint_Write_8(mouse_protocol);
+                    Endpoint_ClearIN();
+                    Endpoint_ClearStatusStage();
+                }
+#endif
             }
 
             break;
@@ -637,6 +667,14 @@ void EVENT_USB_Device_ControlRequest(void) {
                     keyboard_protocol = (USB_ControlRequest.wValue & 0xFF);
                     clear_keyboard();
                 }
+#if defined(MOUSE_ENABLE) && !defined(MOUSE_SHARED_EP)
+                if (USB_ControlRequest.wIndex == MOUSE_INTERFACE) {
+                    Endpoint_ClearSETUP();
+                    Endpoint_ClearStatusStage();
+
+                    mouse_protocol = (USB_ControlRequest.wValue & 0xFF);
+                }
+#endif
             }
 
             break;
@@ -676,6 +714,22 @@ void EVENT_USB_Device_ControlRequest(void) {
  */
 static uint8_t keyboard_leds(void) { return keyboard_led_state; }
 
+/** \brief Whether send_keyboard() can write a report without waiting for the endpoint
+ */
+bool host_keyboard_ready(void) {
+#ifdef BLUETOOTH_ENABLE
+    if (where_to_send() == OUTPUT_BLUETOOTH) return true;
+#endif
+    if (USB_DeviceState != DEVICE_STATE_Configured) return false;
+
+    uint8_t ep = KEYBOARD_IN_EPNUM;
+#ifdef NKRO_ENABLE
+    if (keyboard_protocol && keymap_config.nkro) ep = SHARED_IN_EPNUM;
+#endif
+    Endpoint_SelectEndpoint(ep);
+    return Endpoint_IsReadWriteAllowed();
+}
+
 /** \brief Send Keyboard
  *
  * FIXME: Needs doc
@@ -740,14 +794,23 @@ static void send_mouse(report_mouse_t *report) {
     if (where_to_send() == OUTPUT_BLUETOOTH) {
 #        ifdef MODULE_ADAFRUIT_BLE
         // FIXME: mouse buttons
+#            ifdef MOUSE_EXTENDED_REPORT
+        adafruit_ble_send_mouse_move(report->boot_x, report->boot_y, report->v, report->h, report->buttons);
+#            else
         adafruit_ble_send_mouse_move(report->x, report->y, report->v, report->h, report->buttons);
+#            endif
 #        else
         serial_send(0xFD);
         serial_send(0x00);
         serial_send(0x03);
         serial_send(report->buttons);
+#            ifdef MOUSE_EXTENDED_REPORT
+        serial_send(report->boot_x);
+        serial_send(report->boot_y);
+#            else
         serial_send(report->x);
         serial_send(report->y);
+#            endif
         serial_send(report->v);  // should try sending the wheel v here
         serial_send(report->h);  // should try sending the wheel h here
         serial_send(0x00);
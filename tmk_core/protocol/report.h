@@ -201,15 +201,42 @@ typedef struct {
     uint32_t usage;
 } __attribute__((packed)) report_programmable_button_t;
 
+#ifdef MOUSE_EXTENDED_REPORT
+typedef int16_t mouse_xy_report_t;
+#    define MOUSE_REPORT_XY_MAX 32767
+#else
+typedef int8_t mouse_xy_report_t;
+#    define MOUSE_REPORT_XY_MAX 127
+#endif
+
+#ifdef POINTING_DEVICE_HIRES_SCROLL_ENABLE
+typedef int16_t mouse_hv_report_t;
+#    define MOUSE_REPORT_HV_MAX 32767
+#    ifndef POINTING_DEVICE_HIRES_SCROLL_MULTIPLIER
+#        define POINTING_DEVICE_HIRES_SCROLL_MULTIPLIER 120
+#    endif
+#    ifndef POINTING_DEVICE_HIRES_SCROLL_EXPONENT
+#        define POINTING_DEVICE_HIRES_SCROLL_EXPONENT 0
+#    endif
+#else
+typedef int8_t mouse_hv_report_t;
+#    define MOUSE_REPORT_HV_MAX 127
+#endif
+
 typedef struct {
 #ifdef MOUSE_SHARED_EP
     uint8_t report_id;
 #endif
     uint8_t buttons;
-    int8_t  x;
-    int8_t  y;
-    int8_t  v;
-    int8_t  h;
+#ifdef MOUSE_EXTENDED_REPORT
+    // Copy of X/Y for hosts using the boot protocol, filled in by host_mouse_send()
+    int8_t boot_x;
+    int8_t boot_y;
+#endif
+    mouse_xy_report_t x;
+    mouse_xy_report_t y;
+    mouse_hv_report_t v;
+    mouse_hv_report_t h;
 } __attribute__((packed)) report_mouse_t;
 
 typedef struct {
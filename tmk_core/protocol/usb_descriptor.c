@@ -126,6 +126,22 @@ const USB_Descriptor_HIDReport_Datatype_t PROGMEM SharedReport[] = {
             HID_RI_REPORT_SIZE(8, 0x01),
             HID_RI_INPUT(8, HID_IOF_DATA | HID_IOF_VARIABLE | HID_IOF_ABSOLUTE),
 
+#    ifdef MOUSE_EXTENDED_REPORT
+            // Boot protocol X/Y, ignored in report protocol (2 bytes)
+            HID_RI_REPORT_COUNT(8, 0x02),
+            HID_RI_REPORT_SIZE(8, 0x08),
+            HID_RI_INPUT(8, HID_IOF_CONSTANT),
+
+            // X/Y position (4 bytes)
+            HID_RI_USAGE_PAGE(8, 0x01),    // Generic Desktop
+            HID_RI_USAGE(8, 0x30),         // X
+            HID_RI_USAGE(8, 0x31),         // Y
+            HID_RI_LOGICAL_MINIMUM(16, -32767),
+            HID_RI_LOGICAL_MAXIMUM(16, 32767),
+            HID_RI_REPORT_COUNT(8, 0x02),
+            HID_RI_REPORT_SIZE(8, 0x10),
+            HID_RI_INPUT(8, HID_IOF_DATA | HID_IOF_VARIABLE | HID_IOF_RELATIVE),
+#    else
             // X/Y position (2 bytes)
             HID_RI_USAGE_PAGE(8, 0x01),    // Generic Desktop
             HID_RI_USAGE(8, 0x30),         // X
@@ -135,7 +151,44 @@ const USB_Descriptor_HIDReport_Datatype_t PROGMEM SharedReport[] = {
             HID_RI_REPORT_COUNT(8, 0x02),
             HID_RI_REPORT_SIZE(8, 0x08),
             HID_RI_INPUT(8, HID_IOF_DATA | HID_IOF_VARIABLE | HID_IOF_RELATIVE),
+#    endif
 
+#    ifdef POINTING_DEVICE_HIRES_SCROLL_ENABLE
+            // Resolution Multiplier for both wheels, set by the host (1 byte feature)
+            HID_RI_COLLECTION(8, 0x02),    // Logical
+                HID_RI_USAGE_PAGE(8, 0x01),    // Generic Desktop
+                HID_RI_USAGE(8, 0x48),         // Resolution Multiplier
+                HID_RI_LOGICAL_MINIMUM(8, 0x00),
+                HID_RI_LOGICAL_MAXIMUM(8, 0x01),
+                HID_RI_PHYSICAL_MINIMUM(8, 0x01),
+                HID_RI_PHYSICAL_MAXIMUM(16, POINTING_DEVICE_HIRES_SCROLL_MULTIPLIER),
+                HID_RI_UNIT_EXPONENT(8, POINTING_DEVICE_HIRES_SCROLL_EXPONENT),
+                HID_RI_REPORT_COUNT(8, 0x01),
+                HID_RI_REPORT_SIZE(8, 0x02),
+                HID_RI_FEATURE(8, HID_IOF_DATA | HID_IOF_VARIABLE | HID_IOF_ABSOLUTE),
+                HID_RI_PHYSICAL_MINIMUM(8, 0x00),
+                HID_RI_PHYSICAL_MAXIMUM(8, 0x00),
+                HID_RI_UNIT_EXPONENT(8, 0x00),
+                HID_RI_REPORT_SIZE(8, 0x06),
+                HID_RI_FEATURE(8, HID_IOF_CONSTANT),
+
+                // Vertical wheel (2 bytes)
+                HID_RI_USAGE(8, 0x38),         // Wheel
+                HID_RI_LOGICAL_MINIMUM(16, -32767),
+                HID_RI_LOGICAL_MAXIMUM(16, 32767),
+                HID_RI_REPORT_COUNT(8, 0x01),
+                HID_RI_REPORT_SIZE(8, 0x10),
+                HID_RI_INPUT(8, HID_IOF_DATA | HID_IOF_VARIABLE | HID_IOF_RELATIVE),
+                // Horizontal wheel (2 bytes)
+                HID_RI_USAGE_PAGE(8, 0x0C),    // Consumer
+                HID_RI_USAGE(16, 0x0238),      // AC Pan
+                HID_RI_LOGICAL_MINIMUM(16, -32767),
+                HID_RI_LOGICAL_MAXIMUM(16, 32767),
+                HID_RI_REPORT_COUNT(8, 0x01),
+                HID_RI_REPORT_SIZE(8, 0x10),
+                HID_RI_INPUT(8, HID_IOF_DATA | HID_IOF_VARIABLE | HID_IOF_RELATIVE),
+            HID_RI_END_COLLECTION(0),
+#    else
             // Vertical wheel (1 byte)
             HID_RI_USAGE(8, 0x38),         // Wheel
             HID_RI_LOGICAL_MINIMUM(8, -127),
@@ -151,6 +204,7 @@ const USB_Descriptor_HIDReport_Datatype_t PROGMEM SharedReport[] = {
             HID_RI_REPORT_COUNT(8, 0x01),
             HID_RI_REPORT_SIZE(8, 0x08),
             HID_RI_INPUT(8, HID_IOF_DATA | HID_IOF_VARIABLE | HID_IOF_RELATIVE),
+#    endif
         HID_RI_END_COLLECTION(0),
     HID_RI_END_COLLECTION(0),
 #    ifndef MOUSE_SHARED_EP
@@ -81,6 +81,10 @@ enum usb_interfaces {
 #    error Mouse/Extra Keys share an endpoint with Console. Please disable one of the two.
 #endif
 
+#if defined(MOUSE_EXTENDED_REPORT) || defined(POINTING_DEVICE_HIRES_SCROLL_ENABLE)
+#    error Extended mouse reports do not fit in a V-USB interrupt transfer. Please disable MOUSE_EXTENDED_REPORT and POINTING_DEVICE_HIRES_SCROLL_ENABLE.
+#endif
+
 static uint8_t keyboard_led_state = 0;
 static uint8_t vusb_idle_rate     = 0;
 
@@ -0,0 +1,76 @@
+#!/bin/bash
+
+# Copyright 2022 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+# Builds a keyboard with each debounce algorithm, both from the current tree and
+# from an older ref (e.g. one still using malloc for the debounce state), and
+# prints the flash and RAM usage of each build side by side.
+
+set -eEuo pipefail
+
+job_count=$(getconf _NPROCESSORS_ONLN 2>/dev/null || sysctl -n hw.ncpu 2>/dev/null || echo 2)
+base_ref="develop"
+debounce_types="sym_defer_g sym_defer_pk sym_defer_vc sym_eager_pk sym_eager_pr asym_eager_defer_pk"
+
+function usage() {
+    echo "Usage: $(basename "$0") [-h] [-j <jobs>] [-b <base>] [-t \"<types>\"] handwired/onekey/promicro:default"
+    echo "    -h           : Shows this usage page."
+    echo "    -j <threads> : Change the number of threads to execute with. Defaults to \`$job_count\`."
+    echo "    -b <base>    : Commit, branch, tag, or sha1 to compare against. Defaults to \`$base_ref\`."
+    echo "    -t <types>   : Space separated debounce algorithms to build. Defaults to \`$debounce_types\`."
+    exit 1
+}
+
+if [[ ${#} -eq 0 ]]; then
+   usage
+fi
+
+while getopts "hj:b:t:" opt "$@" ; do
+    case "$opt" in
+        h) usage; exit 0;;
+        j) job_count="${OPTARG:-}";;
+        b) base_ref="${OPTARG:-}";;
+        t) debounce_types="${OPTARG:-}";;
+        \?) usage >&2; exit 1;;
+    esac
+done
+
+shift $((OPTIND-1))
+keyboard_target=$1
+
+qmk_root=$(git rev-parse --show-toplevel)
+base_tree=$(mktemp -d)
+build_root=$(mktemp -d)
+trap 'git -C "$qmk_root" worktree remove --force "$base_tree" >/dev/null 2>&1 || true ; rm -rf "$build_root"' EXIT
+git -C "$qmk_root" worktree add --detach "$base_tree" "$base_ref" >/dev/null 2>&1 || { echo "Failed to check out ${base_ref}" >&2 ; exit 1 ; }
+git -C "$base_tree" submodule update --init --recursive >/dev/null 2>&1 || true
+
+# Prints "<flash> <ram>" for the firmware built in the given tree, or "- -" if the build failed.
+# Each build gets a fresh build directory, so the caller's own .build is never touched or cleaned.
+function build_size() {
+    local tree=$1 debounce_type=$2 build_dir elf size_tool
+
+    build_dir=$(mktemp -d "$build_root/build.XXXXXX")
+    if ! make -C "$tree" -j${job_count} "$keyboard_target" DEBOUNCE_TYPE="$debounce_type" SKIP_GIT=yes BUILD_DIR="$build_dir" >/dev/null 2>&1 ; then
+        echo "- -"
+        return
+    fi
+
+    elf=$(ls -t "$build_dir"/*.elf 2>/dev/null | head -n1)
+    size_tool=arm-none-eabi-size
+    if avr-size "$elf" >/dev/null 2>&1 ; then size_tool=avr-size ; fi
+    $size_tool "$elf" | awk '/elf/ {print $1 + $2, $2 + $3}'
+}
+
+printf "%-20s %10s %10s %8s %8s %8s %8s\n" "DEBOUNCE_TYPE" "base flash" "flash" "delta" "base RAM" "RAM" "delta"
+for debounce_type in $debounce_types ; do
+    read -r base_flash base_ram <<< "$(build_size "$base_tree" "$debounce_type")"
+    read -r flash ram <<< "$(build_size "$qmk_root" "$debounce_type")"
+
+    if [[ "$base_flash" == "-" ]] || [[ "$flash" == "-" ]] ; then
+        printf "%-20s %10s %10s %8s %8s %8s %8s\n" "$debounce_type" "$base_flash" "$flash" "-" "$base_ram" "$ram" "-"
+    else
+        printf "%-20s %10d %10d %+8d %8d %8d %+8d\n" "$debounce_type" "$base_flash" "$flash" $(( flash - base_flash )) "$base_ram" "$ram" $(( ram - base_ram ))
+    fi
+done